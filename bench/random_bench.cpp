@@ -0,0 +1,67 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file bench/random_bench.cpp
+/// @brief Cost of a uniform value drawn with abz::rand and with the standard distributions, on
+/// the default engine (<tt>std::minstd_rand</tt> unless ABZ_RANDOM_DEFAULT_ENGINE is set) and on
+/// a 64-bit engine.
+
+#include "abz/random/random.hpp"
+#include "abz/random/xoshiro.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace {
+
+constexpr int iterations = 10000000;
+
+template <class Function>
+void run(const char *name, Function f)
+{
+  using clock = std::chrono::steady_clock;
+  double sink = 0;
+  for (int i = 0; i < iterations / 10; ++i) sink += f();
+  const clock::time_point start = clock::now();
+  for (int i = 0; i < iterations; ++i) sink += f();
+  const clock::duration elapsed = clock::now() - start;
+  std::printf("%-48s %6.2f ns  (%g)\n", name,
+              std::chrono::duration<double, std::nano>(elapsed).count() / iterations, sink);
+}
+
+template <class Engine>
+void bench(const char *engine_name)
+{
+  std::printf("%s\n", engine_name);
+  Engine g{42};
+  std::uniform_int_distribution<int> std_int{0, 99};
+  std::uniform_real_distribution<double> std_real{-1., 1.};
+  run("  std::uniform_int_distribution<int>{0, 99}", [&] { return std_int(g); });
+  run("  abz::rand<int>(g, 0, 99)", [&] { return abz::rand<int>(g, 0, 99); });
+  run("  std::uniform_real_distribution<double>{-1, 1}", [&] { return std_real(g); });
+  run("  abz::rand<double>(g, -1, 1)", [&] { return abz::rand<double>(g, -1., 1.); });
+}
+
+} // namespace
+
+int main()
+{
+  bench<abz::random::default_engine>("default_engine");
+  bench<abz::random::xoshiro256starstar>("xoshiro256starstar");
+  std::printf("thread-local default_engine\n");
+  run("  abz::rand<int>(0, 99)", [] { return abz::rand<int>(0, 99); });
+  run("  abz::rand<double>(-1, 1)", [] { return abz::rand<double>(-1., 1.); });
+  return 0;
+}
@@ -0,0 +1,224 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_chrono_latency_histogram_hpp
+#define abz_chrono_latency_histogram_hpp
+
+/// @file latency_histogram.hpp
+/// @brief Log-linear histogram of durations.
+///
+/// @reference G. Tene. HdrHistogram: A High Dynamic Range Histogram. http://hdrhistogram.org/
+
+#include "abz/compiler.hpp"
+#include "abz/detail/macros.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Returns the index of the highest set bit of @p x, which must not be null.
+inline unsigned highest_bit(std::uint64_t x) noexcept
+{
+#if defined(ABZ_COMPILER_GCC) || defined(ABZ_COMPILER_CLANG)
+  return 63u - static_cast<unsigned>(__builtin_clzll(x));
+#else
+  unsigned n = 0;
+  while (x >>= 1) ++n;
+  return n;
+#endif
+}
+
+class atomic_latency_histogram;
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+/// @class latency_histogram
+/// @brief Log-linear histogram of durations.
+///
+/// The buckets of an HDR histogram: every power of two of nanoseconds is split into 32 buckets of
+/// equal width, so that any duration from a nanosecond to centuries is counted with a relative
+/// error below 3.2%, in a fixed array of counters. Recording a value is a count of leading zeros,
+/// a shift and an increment.
+///
+/// The histograms of several threads are merged by adding their counters: see
+/// @ref latency_recorder for the lock-free recording from many threads.
+class latency_histogram {
+public:
+  /// @name Member types and constants
+  /// @{
+
+  using duration = std::chrono::nanoseconds; ///< The durations counted.
+
+  static constexpr unsigned precision_bits = 5; ///< The log2 of the buckets per power of two.
+  static constexpr std::size_t sub_buckets = std::size_t{1} << precision_bits;
+  static constexpr std::size_t bucket_count = (65 - precision_bits) * sub_buckets;
+
+  /// @}
+
+  /// @name Buckets
+  /// @{
+
+  /// Returns the bucket of @p ns nanoseconds.
+  static std::size_t bucket(const std::uint64_t ns) noexcept
+  {
+    if (ns < 2 * sub_buckets) return static_cast<std::size_t>(ns);
+    const unsigned shift = _::highest_bit(ns) - precision_bits;
+    return (shift + 1) * sub_buckets + static_cast<std::size_t>(ns >> shift) - sub_buckets;
+  }
+
+  /// Returns the lowest value, in nanoseconds, counted in bucket @p i.
+  static std::uint64_t lowest(const std::size_t i) noexcept
+  {
+    if (i < 2 * sub_buckets) return i;
+    const unsigned shift = static_cast<unsigned>(i / sub_buckets - 1);
+    return static_cast<std::uint64_t>(i % sub_buckets + sub_buckets) << shift;
+  }
+
+  /// Returns the highest value, in nanoseconds, counted in bucket @p i.
+  static std::uint64_t highest(const std::size_t i) noexcept
+  {
+    if (i < 2 * sub_buckets) return i;
+    const unsigned shift = static_cast<unsigned>(i / sub_buckets - 1);
+    return lowest(i) + ((std::uint64_t{1} << shift) - 1);
+  }
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  latency_histogram() noexcept { reset(); }
+
+  /// Clears the histogram.
+  void reset() noexcept
+  {
+    counts_.fill(0);
+    count_ = 0;
+    sum_ = 0;
+    min_ = ~std::uint64_t{0};
+    max_ = 0;
+  }
+
+  /// @}
+
+  /// @name Recording
+  /// @{
+
+  /// Counts @p n occurrences of @p d. Negative durations are counted as 0.
+  void record(const duration d, const std::uint64_t n = 1) noexcept
+  {
+    const std::uint64_t ns = d.count() > 0 ? static_cast<std::uint64_t>(d.count()) : 0;
+    counts_[bucket(ns)] += n;
+    count_ += n;
+    sum_ += ns * n;
+    if (ns < min_) min_ = ns;
+    if (ns > max_) max_ = ns;
+  }
+
+  /// Adds the counts of @p other.
+  latency_histogram &operator+=(const latency_histogram &other) noexcept
+  {
+    for (std::size_t i = 0; i < bucket_count; ++i) counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    sum_ += other.sum_;
+    if (other.min_ < min_) min_ = other.min_;
+    if (other.max_ > max_) max_ = other.max_;
+    return *this;
+  }
+
+  /// @}
+
+  /// @name Statistics
+  /// @{
+
+  /// Returns the number of durations counted.
+  std::uint64_t count() const noexcept { return count_; }
+
+  /// Returns the number of durations counted in bucket @p i.
+  std::uint64_t count(const std::size_t i) const noexcept { return counts_[i]; }
+
+  /// Returns the least duration counted, or 0 if the histogram is empty.
+  duration min() const noexcept { return count_ != 0 ? to_duration(min_) : duration{0}; }
+
+  /// Returns the greatest duration counted, or 0 if the histogram is empty.
+  duration max() const noexcept { return to_duration(max_); }
+
+  /// Returns the mean of the durations counted, or 0 if the histogram is empty.
+  duration mean() const noexcept
+  {
+    return count_ != 0 ? to_duration(sum_ / count_) : duration{0};
+  }
+
+  /// Returns the duration below which @p q percent of the durations counted fall, within the
+  /// precision of the buckets (e.g. percentile(99.9) for the p999), or 0 if the histogram is empty.
+  duration percentile(const double q) const noexcept
+  {
+    if (count_ == 0) return duration{0};
+    if (q <= 0.) return min();
+    // The rank of the value, from 1 to count().
+    const double target = q >= 100. ? static_cast<double>(count_) : q / 100. * count_;
+    std::uint64_t rank = static_cast<std::uint64_t>(target);
+    if (static_cast<double>(rank) < target || rank == 0) ++rank;
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+      seen += counts_[i];
+      if (seen >= rank) {
+        const std::uint64_t ns = highest(i);
+        return to_duration(ns < max_ ? ns : max_);
+      }
+    }
+    return max();
+  }
+
+  /// @}
+
+  /// Writes the count, the mean, the p50, p99, p999 and the maximum of @p h.
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const latency_histogram &h)
+  {
+    return os << "count=" << h.count() << " mean=" << h.mean().count()
+              << "ns p50=" << h.percentile(50.).count() << "ns p99=" << h.percentile(99.).count()
+              << "ns p999=" << h.percentile(99.9).count() << "ns max=" << h.max().count() << "ns";
+  }
+
+private:
+  friend class _::atomic_latency_histogram;
+
+  static duration to_duration(const std::uint64_t ns) noexcept
+  {
+    return duration{static_cast<duration::rep>(ns)};
+  }
+
+  std::array<std::uint64_t, bucket_count> counts_;
+  std::uint64_t count_;
+  std::uint64_t sum_;
+  std::uint64_t min_;
+  std::uint64_t max_;
+};
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
+
+#endif // abz_chrono_latency_histogram_hpp
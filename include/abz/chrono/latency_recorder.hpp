@@ -0,0 +1,235 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_chrono_latency_recorder_hpp
+#define abz_chrono_latency_recorder_hpp
+
+/// @file latency_recorder.hpp
+/// @brief Per-thread latency histograms fed by scoped timers.
+
+#include "abz/chrono/latency_histogram.hpp"
+#include "abz/chrono/thread_clock.hpp"
+#include "abz/chrono/tsc_clock.hpp"
+#include "abz/detail/macros.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// A latency_histogram written by a single thread and read by any other one.
+///
+/// The writer increments the counters with relaxed loads and stores, without any locked
+/// instruction. A reader may miss the latest values, but never sees torn counters.
+class atomic_latency_histogram {
+public:
+  atomic_latency_histogram() noexcept
+  {
+    for (auto &c : counts_) c.store(0, std::memory_order_relaxed);
+  }
+
+  void record(const latency_histogram::duration d) noexcept
+  {
+    const std::uint64_t ns = d.count() > 0 ? static_cast<std::uint64_t>(d.count()) : 0;
+    add(counts_[latency_histogram::bucket(ns)], 1);
+    add(count_, 1);
+    add(sum_, ns);
+    if (ns < min_.load(std::memory_order_relaxed)) min_.store(ns, std::memory_order_relaxed);
+    if (ns > max_.load(std::memory_order_relaxed)) max_.store(ns, std::memory_order_relaxed);
+  }
+
+  /// Adds the counts to @p h.
+  void load(latency_histogram &h) const noexcept
+  {
+    std::uint64_t count = 0;
+    for (std::size_t i = 0; i < latency_histogram::bucket_count; ++i) {
+      const std::uint64_t n = counts_[i].load(std::memory_order_relaxed);
+      h.counts_[i] += n;
+      count += n;
+    }
+    if (count == 0) return;
+    // The buckets are the reference: the other statistics may lag behind them.
+    h.count_ += count;
+    h.sum_ += sum_.load(std::memory_order_relaxed);
+    const std::uint64_t min = min_.load(std::memory_order_relaxed);
+    const std::uint64_t max = max_.load(std::memory_order_relaxed);
+    if (min < h.min_) h.min_ = min;
+    if (max > h.max_) h.max_ = max;
+  }
+
+private:
+  static void add(std::atomic<std::uint64_t> &c, const std::uint64_t n) noexcept
+  {
+    c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  std::atomic<std::uint64_t> counts_[latency_histogram::bucket_count];
+  std::atomic<std::uint64_t> count_{0};
+  std::atomic<std::uint64_t> sum_{0};
+  std::atomic<std::uint64_t> min_{~std::uint64_t{0}};
+  std::atomic<std::uint64_t> max_{0};
+};
+
+/// The histograms of a thread.
+struct latency_shard {
+  atomic_latency_histogram cpu;
+  atomic_latency_histogram wall;
+  latency_shard *next = nullptr;
+};
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+/// The merged histograms of a @ref latency_recorder.
+struct latency_report {
+  latency_histogram cpu;  ///< The CPU time of the calling thread, from @ref thread_clock.
+  latency_histogram wall; ///< The wall time, from @ref tsc_clock.
+
+  /// Writes the percentiles of both histograms.
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const latency_report &r)
+  {
+    return os << "cpu: " << r.cpu << os.widen('\n') << "wall: " << r.wall;
+  }
+};
+
+/// @class latency_recorder
+/// @brief Per-thread latency histograms fed by scoped timers.
+///
+/// A recorder collects the durations of a code path, e.g. a request handler, measured with a
+/// @ref scoped_timer. Each thread records into histograms of its own, in CPU time and in wall
+/// time, without any lock nor locked instruction: recording costs a bucket computation and a few
+/// plain stores, so that the instrumentation does not distort the hot paths it measures. report()
+/// merges the histograms of all the threads on demand, e.g. from a monitoring thread, while they
+/// keep recording.
+///
+/// The histograms of a thread are allocated when it first records (about 30 KiB) and kept, with
+/// their counts, until the recorder is destroyed: recorders are meant to be long-lived, e.g.
+/// static, and shared by a pool of threads. The identifiers of destroyed recorders are reused, so
+/// that creating recorders repeatedly does not grow the per-thread tables of shards.
+///
+/// @code
+/// static abz::chrono::latency_recorder handle_latency;
+///
+/// void handle(const request &r)
+/// {
+///   const abz::chrono::scoped_timer timer{handle_latency};
+///   // ...
+/// }
+///
+/// std::cout << handle_latency.report() << '\n';
+/// @endcode
+class latency_recorder {
+public:
+  using duration = latency_histogram::duration; ///< The durations recorded.
+
+  /// @name Construction
+  /// @{
+
+  /// Creates a recorder measuring the CPU time if @p cpu_time, the wall time only otherwise.
+  /// Reading @ref thread_clock is a system call, which costs much more than @ref tsc_clock.
+  explicit latency_recorder(bool cpu_time = true);
+  ~latency_recorder();
+
+  latency_recorder(const latency_recorder &) = delete;
+  latency_recorder &operator=(const latency_recorder &) = delete;
+
+  /// @}
+
+  /// @name Functions
+  /// @{
+
+  /// Returns true if the CPU time is measured.
+  bool cpu_time() const noexcept { return cpu_time_; }
+
+  /// Records a duration measured by the calling thread, in CPU time and in wall time.
+  ///
+  /// Throws <tt>std::bad_alloc</tt> if the histograms of the thread cannot be allocated.
+  void record(const duration cpu, const duration wall)
+  {
+    record(local(), cpu, wall);
+  }
+
+  /// Returns the histograms of all the threads, merged.
+  latency_report report() const;
+
+  /// @}
+
+private:
+  friend class scoped_timer;
+
+  void record(_::latency_shard &s, const duration cpu, const duration wall) const noexcept
+  {
+    if (cpu_time_) s.cpu.record(cpu);
+    s.wall.record(wall);
+  }
+
+  /// Returns the histograms of the calling thread, allocating them on its first call.
+  _::latency_shard &local();
+  _::latency_shard &add_local();
+
+  const std::size_t id_;
+  const std::uint64_t serial_;
+  const bool cpu_time_;
+  std::atomic<_::latency_shard *> shards_{nullptr};
+};
+
+/// @class scoped_timer
+/// @brief Records the duration of a scope in a @ref latency_recorder.
+///
+/// The clocks are read in the reverse order at the end of the scope, so that each interval
+/// includes as little as possible of the reading of the other clock. The histograms of the thread
+/// are allocated by the constructor, which throws <tt>std::bad_alloc</tt> on failure, so that the
+/// destructor records without allocating.
+class scoped_timer {
+public:
+  /// Starts timing.
+  explicit scoped_timer(latency_recorder &recorder)
+    : recorder_(recorder)
+    , shard_(recorder.local())
+  {
+    if (recorder_.cpu_time()) cpu_ = thread_clock::now();
+    wall_ = tsc_clock::now();
+  }
+
+  /// Records the duration of the scope.
+  ~scoped_timer()
+  {
+    const tsc_clock::time_point wall = tsc_clock::now();
+    const thread_clock::time_point cpu = recorder_.cpu_time() ? thread_clock::now() : cpu_;
+    recorder_.record(shard_, cpu - cpu_, wall - wall_);
+  }
+
+  scoped_timer(const scoped_timer &) = delete;
+  scoped_timer &operator=(const scoped_timer &) = delete;
+
+private:
+  latency_recorder &recorder_;
+  _::latency_shard &shard_;
+  thread_clock::time_point cpu_;
+  tsc_clock::time_point wall_;
+};
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
+
+#endif // abz_chrono_latency_recorder_hpp
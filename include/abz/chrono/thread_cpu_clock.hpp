@@ -0,0 +1,103 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_chrono_thread_cpu_clock_hpp
+#define abz_chrono_thread_cpu_clock_hpp
+
+/// @file thread_cpu_clock.hpp
+/// @brief CPU clock of any thread of the process.
+
+#include "abz/chrono/thread_clock.hpp"
+#include "abz/detail/macros.hpp"
+
+#include <chrono>
+#include <thread>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+/// @class thread_cpu_clock
+/// @brief CPU clock of any thread of the process.
+///
+/// Where @ref thread_clock can only read the CPU time of the calling thread, a thread_cpu_clock is
+/// bound to a given thread and can be read from any other one, e.g. by a monitoring thread. Its
+/// time points are the ones of @ref thread_clock: both clocks return the same value when read from
+/// the bound thread.
+///
+/// Unlike the standard clocks, now() is not static. It returns a default constructed time point
+/// when the clock is not valid(), or once the thread has been joined.
+///
+/// @code
+/// std::thread worker{work};
+/// const abz::chrono::thread_cpu_clock clock{worker};
+/// // ...
+/// const auto busy = clock.now().time_since_epoch();
+/// @endcode
+class thread_cpu_clock {
+public:
+  /// @name Member types
+  /// @{
+
+  using duration = thread_clock::duration;     ///< The time interval of the clock.
+  using rep = duration::rep;                   ///< Type representing the number of ticks.
+  using period = duration::period;             ///< A std::ratio of the ticks per second.
+  using time_point = thread_clock::time_point; ///< The time points of @ref thread_clock.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr bool is_steady = true; ///< True if the clock is monotonic.
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  /// Binds the clock to the calling thread.
+  thread_cpu_clock() noexcept;
+
+  /// Binds the clock to the thread of native handle @p handle.
+  explicit thread_cpu_clock(std::thread::native_handle_type handle) noexcept;
+
+  /// Binds the clock to the running thread @p thread.
+  explicit thread_cpu_clock(std::thread &thread) noexcept
+    : thread_cpu_clock(thread.native_handle())
+  {
+  }
+
+  /// @}
+
+  /// @name Functions
+  /// @{
+
+  /// Returns true if the clock is bound to a thread.
+  bool valid() const noexcept { return valid_; }
+
+  /// Returns a time_point representing the current value of the clock.
+  time_point now() const noexcept;
+
+  /// @}
+
+private:
+  long clock_ = 0;
+  bool valid_ = false;
+};
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
+
+#endif // abz_chrono_thread_cpu_clock_hpp
@@ -0,0 +1,112 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_chrono_thread_cpu_sampler_hpp
+#define abz_chrono_thread_cpu_sampler_hpp
+
+/// @file thread_cpu_sampler.hpp
+/// @brief Snapshots of the CPU time of all the threads of the process.
+
+#include "abz/chrono/thread_clock.hpp"
+#include "abz/detail/macros.hpp"
+
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+/// Returns the kernel identifier of the calling thread, as found in the samples of
+/// @ref thread_cpu_sampler, or -1 when it is not available.
+long this_thread_id() noexcept;
+
+/// @class thread_cpu_sampler
+/// @brief Snapshots of the CPU time of all the threads of the process.
+///
+/// Meant for monitoring threads: snapshot() reads the CPU time of every thread of the process at
+/// once, to spot imbalance and hot threads between two snapshots.
+///
+/// On Linux, the threads are listed from @c /proc/self/task. The sampler keeps the directory and
+/// the per-thread statistics files open between snapshots, so that a snapshot costs one listing
+/// of the directory and a single @c pread per thread, without opening nor parsing anything else:
+/// a few microseconds for tens of threads. The time is read with nanosecond resolution from
+/// @c schedstat when the kernel provides it, or else from the user and system times of @c stat,
+/// counted in clock ticks.
+///
+/// A sampler is not thread safe: use one per monitoring thread.
+///
+/// @code
+/// abz::chrono::thread_cpu_sampler sampler;
+/// std::vector<abz::chrono::thread_cpu_sampler::sample> samples;
+/// if (sampler.snapshot(samples)) {
+///   for (const auto &s : samples) report(s.thread_id, s.cpu_time);
+/// }
+/// @endcode
+class thread_cpu_sampler {
+public:
+  /// @name Member types
+  /// @{
+
+  using duration = thread_clock::duration; ///< The CPU time of a thread.
+
+  /// The CPU time of a thread.
+  struct sample {
+    long thread_id;    ///< The kernel identifier of the thread, see this_thread_id().
+    duration cpu_time; ///< The CPU time consumed by the thread since its creation.
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  thread_cpu_sampler() noexcept;
+  ~thread_cpu_sampler();
+
+  thread_cpu_sampler(const thread_cpu_sampler &) = delete;
+  thread_cpu_sampler &operator=(const thread_cpu_sampler &) = delete;
+
+  /// @}
+
+  /// @name Functions
+  /// @{
+
+  /// Returns true if snapshots are supported on the platform.
+  bool valid() const noexcept { return tasks_ != nullptr; }
+
+  /// Replaces the content of @p samples with the CPU time of every running thread of the
+  /// process, sorted by thread identifier. Returns false, with @p samples empty, on failure.
+  bool snapshot(std::vector<sample> &samples);
+
+  /// @}
+
+private:
+  struct task {
+    long id;
+    int fd; // -1 when the file could not be opened again.
+  };
+
+  bool list_tasks();
+  bool read_task(task &t, duration &cpu_time);
+
+  void *tasks_ = nullptr; // The directory stream of the task directory.
+  bool schedstat_ = false;
+  std::vector<task> open_;
+  std::vector<long> ids_;
+};
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
+
+#endif // abz_chrono_thread_cpu_sampler_hpp
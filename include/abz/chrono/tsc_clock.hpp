@@ -0,0 +1,88 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_chrono_tsc_clock_hpp
+#define abz_chrono_tsc_clock_hpp
+
+/// @file tsc_clock.hpp
+/// @brief Wall clock reading the time stamp counter.
+
+#include "abz/detail/macros.hpp"
+
+#include <chrono>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+/// @class tsc_clock
+/// @brief Wall clock reading the time stamp counter.
+///
+/// A time point is a single @c rdtsc instruction scaled to nanoseconds, without any system call
+/// nor vDSO: reading the clock costs a few nanoseconds, see overhead(). The clock is anchored to
+/// <tt>std::chrono::steady_clock</tt> at the calibration, so that both clocks agree then, but
+/// their rates differ by the calibration error (about \f$10^{-5}\f$, i.e. milliseconds over
+/// minutes): the clock is meant for measuring intervals, and its time points should not be
+/// compared with the ones of <tt>std::chrono::steady_clock</tt> long after the calibration.
+///
+/// The frequency of the counter is calibrated against <tt>std::chrono::steady_clock</tt> once, on
+/// the first use of the clock (it takes a few milliseconds, so that programs that need steady
+/// timings should call now() during their initialization). The counter is only used when the
+/// CPU reports it as invariant, i.e. ticking at a constant rate in every power state. Otherwise,
+/// and on other architectures, the clock falls back to <tt>std::chrono::steady_clock</tt>: see
+/// uses_tsc().
+class tsc_clock {
+public:
+  /// @name Member types
+  /// @{
+
+  using duration = std::chrono::nanoseconds; ///< The time interval of the clock.
+  using rep = duration::rep;       ///< Type representing the number of ticks in the clock duration.
+  using period = duration::period; ///< A std::ratio representing the number of ticks per second.
+  using time_point = std::chrono::time_point<tsc_clock>; ///< A std::time_point for the clock.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr bool is_steady = true; ///< True if the clock is monotonic.
+
+  /// @}
+
+  /// @name Static functions
+  /// @{
+
+  /// Returns a time_point representing the current value of the clock.
+  static time_point now() noexcept;
+
+  /// Returns true when the clock reads the invariant time stamp counter, false when it falls back
+  /// to <tt>std::chrono::steady_clock</tt>.
+  static bool uses_tsc() noexcept;
+
+  /// Returns the calibrated frequency of the time stamp counter in ticks per second, or 0 when the
+  /// counter is not used.
+  static double frequency() noexcept;
+
+  /// Returns the average cost of now(), measured once on the first call. Subtract it from the
+  /// intervals measured with the clock to get the time spent between the two calls.
+  static duration overhead() noexcept;
+
+  /// @}
+};
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
+
+#endif // abz_chrono_tsc_clock_hpp
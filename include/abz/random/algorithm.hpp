@@ -18,13 +18,346 @@
 /// Pseudorandom numbers algorithms.
 
 #include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+#include "abz/random/detail/parallel.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+#include "abz/random/quasi_random.hpp"
 #include "abz/random/random.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 ABZ_NAMESPACE_BEGIN
 
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+template <class OutputIterator, class Engine>
+inline void generate_default_n(Engine &g, OutputIterator first, std::size_t count, std::false_type)
+{
+  using value_type = typename std::iterator_traits<OutputIterator>::value_type;
+  std::generate_n(first, count, [&]() { return abz::rand<value_type>(g); });
+}
+
+/// Ranges of booleans that are not contiguous (<tt>std::vector<bool></tt>) take a bit of a word
+/// per element.
+template <class OutputIterator, class Engine>
+inline void generate_default_n(Engine &g, OutputIterator first, std::size_t count, std::true_type)
+{
+  for (; count != 0;) {
+    const unsigned n = static_cast<unsigned>(std::min<std::size_t>(count, 64));
+    const std::uint64_t w = random_bits<std::uint64_t>(g);
+    for (unsigned i = 0; i < n; ++i, ++first) *first = ((w >> i) & 1u) != 0;
+    count -= n;
+  }
+}
+
+/// Writes @p count values drawn with the default parameters of @ref abz::rand to @p first.
+template <class OutputIterator, class Engine>
+inline void generate_default_n(Engine &g, OutputIterator first, const std::size_t count)
+{
+  generate_default_n(
+    g, first, count,
+    std::is_same<typename std::iterator_traits<OutputIterator>::value_type, bool>{});
+}
+
+/// Writes @p count values of the bulk path to @p first through a buffer, so that the ranges that
+/// are not contiguous get the same values as the contiguous ones.
+template <class OutputIterator, class Engine>
+inline void buffered_bulk_generate(Engine &g, OutputIterator first, std::size_t count)
+{
+  using value_type = typename std::iterator_traits<OutputIterator>::value_type;
+  // Whole words per chunk: the chunks take the same words as a single bulk_generate() call.
+  constexpr std::size_t chunk = 64 * values_per_word<value_type>::value;
+  value_type buffer[chunk];
+  while (count != 0) {
+    const std::size_t n = std::min(count, chunk);
+    bulk_generate(g, buffer, n);
+    first = std::copy(buffer, buffer + n, first);
+    count -= n;
+  }
+}
+
+/// Writes @p count values drawn like the bulk path when their type supports it (whatever the
+/// iterator), or with the default parameters of @ref abz::rand otherwise.
+template <class OutputIterator>
+inline void fill_default_n(OutputIterator first, const std::size_t count, std::true_type)
+{
+  buffered_bulk_generate(thread_local_engine<random::xoshiro256starstar_x8>(), first, count);
+}
+
+template <class OutputIterator>
+inline void fill_default_n(OutputIterator first, const std::size_t count, std::false_type)
+{
+  generate_default_n(thread_local_engine<random::default_engine>(), first, count);
+}
+
+template <class ForwardIterator>
+inline void fill(ForwardIterator first, ForwardIterator last, std::false_type)
+{
+  fill_default_n(
+    first, static_cast<std::size_t>(std::distance(first, last)),
+    is_bulk_generable<typename std::iterator_traits<ForwardIterator>::value_type>{});
+}
+
+template <class ContiguousIterator>
+inline void fill(ContiguousIterator first, ContiguousIterator last, std::true_type)
+{
+  if (first == last) return;
+  bulk_generate(thread_local_engine<random::xoshiro256starstar_x8>(), &*first,
+                static_cast<std::size_t>(last - first));
+}
+
+template <class OutputIterator, class Size>
+inline void fill_n(OutputIterator first, Size count, std::false_type)
+{
+  if (count <= 0) return;
+  fill_default_n(first, static_cast<std::size_t>(count),
+                 is_bulk_generable<typename std::iterator_traits<OutputIterator>::value_type>{});
+}
+
+template <class ContiguousIterator, class Size>
+inline void fill_n(ContiguousIterator first, Size count, std::true_type)
+{
+  if (count <= 0) return;
+  bulk_generate(thread_local_engine<random::xoshiro256starstar_x8>(), &*first,
+                static_cast<std::size_t>(count));
+}
+
+/// Sampling method of the \f$[a, b]\f$ fills: 0 for bounded integers, 1 for the vectorized reals,
+/// 2 for @ref abz::rand.
+template <class T>
+using uniform_fill_method = std::integral_constant<
+  int,
+  std::is_integral<T>::value
+    ? 0
+    : std::is_same<T, float>::value || std::is_same<T, double>::value ? 1 : 2>;
+
+template <class OutputIterator, class Engine, class Integral>
+inline void fill_chunk(Engine &g,
+                       OutputIterator first,
+                       const std::size_t count,
+                       const Integral a,
+                       const Integral b,
+                       std::integral_constant<int, 0>)
+{
+  const uniform_int_sampler<Integral> sampler{a, b};
+  std::generate_n(first, count, [&]() { return sampler(g); });
+}
+
+template <class OutputIterator, class Engine, class Real>
+inline void fill_chunk(Engine &g,
+                       OutputIterator first,
+                       const std::size_t count,
+                       const Real a,
+                       const Real b,
+                       std::integral_constant<int, 1>)
+{
+  uniform_real_n<Real, random::interval::closed>(g, first, count,
+                                                 uniform_real_scale<Real>{a, b - a, a, b});
+}
+
+template <class OutputIterator, class Engine, class T>
+inline void fill_chunk(Engine &g,
+                       OutputIterator first,
+                       const std::size_t count,
+                       const T a,
+                       const T b,
+                       std::integral_constant<int, 2>)
+{
+  std::generate_n(first, count, [&]() { return abz::rand<T>(g, a, b); });
+}
+
+/// Fills \f$[first, first + count)\f$ with values of \f$[a, b]\f$ drawn from the engine of the
+/// vectorized path.
+template <class OutputIterator, class Size, class T>
+inline void fill_n(OutputIterator first, const Size count, const T a, const T b)
+{
+  if (count <= 0) return;
+  fill_chunk(thread_local_engine<random::xoshiro256starstar_x8>(), first,
+             static_cast<std::size_t>(count), a, b, uniform_fill_method<T>{});
+}
+
+template <class RandomIterator, class Engine>
+inline void fill_chunk(Engine &g, RandomIterator first, std::size_t count, std::false_type)
+{
+  fill_chunk(g, first, count, std::false_type{},
+             is_bulk_generable<typename std::iterator_traits<RandomIterator>::value_type>{});
+}
+
+template <class RandomIterator, class Engine>
+inline void fill_chunk(
+  Engine &g, RandomIterator first, std::size_t count, std::false_type, std::true_type)
+{
+  buffered_bulk_generate(g, first, count);
+}
+
+template <class RandomIterator, class Engine>
+inline void fill_chunk(
+  Engine &g, RandomIterator first, std::size_t count, std::false_type, std::false_type)
+{
+  generate_default_n(g, first, count);
+}
+
+template <class ContiguousIterator, class Engine>
+inline void fill_chunk(Engine &g, ContiguousIterator first, std::size_t count, std::true_type)
+{
+  if (count != 0) bulk_generate(g, &*first, count);
+}
+
+/// Copies the words drawn from @p g to the @p size bytes of @p out.
+template <class Engine>
+void fill_bytes(Engine &g, unsigned char *out, std::size_t size)
+{
+  constexpr std::size_t chunk = 512;
+  alignas(64) std::uint64_t words[chunk];
+  while (size != 0) {
+    const std::size_t n = std::min(chunk, (size + 7) / 8);
+    const std::size_t m = std::min(size, n * sizeof(std::uint64_t));
+    random_words(g, words, n);
+    std::memcpy(out, words, m);
+    out += m;
+    size -= m;
+  }
+}
+
+/// Sets the first @p bits bits of @p out (from the least significant bit of each byte), leaving
+/// the others unchanged.
+template <class Engine>
+void fill_bits(Engine &g, unsigned char *out, const std::size_t bits)
+{
+  fill_bytes(g, out, bits / 8);
+  if (const unsigned r = static_cast<unsigned>(bits % 8)) {
+    const unsigned mask = (1u << r) - 1;
+    unsigned char &last = out[bits / 8];
+    last = static_cast<unsigned char>((last & ~mask) | (random_bits<std::uint32_t>(g) & mask));
+  }
+}
+
+/// Writes the coordinates of the next points of @p sequence to the @p count elements of @p first,
+/// through a buffer of whole points.
+template <class Sequence, class OutputIterator>
+void fill_points(Sequence &sequence, OutputIterator first, std::size_t count)
+{
+  using value_type = typename std::iterator_traits<OutputIterator>::value_type;
+  using real_type =
+    typename std::conditional<std::is_same<value_type, float>::value, float, double>::type;
+  constexpr std::size_t chunk = 4096;
+  const std::size_t d = sequence.dimensions();
+  std::vector<real_type> buffer(std::max(chunk / d, std::size_t{1}) * d);
+  while (count != 0) {
+    const std::size_t points = std::min(buffer.size() / d, (count + d - 1) / d);
+    const std::size_t written
+      = static_cast<std::size_t>(sequence.generate_n(buffer.data(), points) - buffer.data());
+    if (written == 0) return; // The end of the sequence.
+    const std::size_t m = std::min(count, written);
+    first = std::copy(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(m), first);
+    count -= m;
+  }
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// Options of the parallel algorithms.
+struct parallel_options {
+  /// Number of threads, the calling thread included. 0 means one per hardware thread.
+  unsigned threads = 0;
+
+  /// Number of elements generated from each substream.
+  ///
+  /// The output of a parallel algorithm depends on its seed and on this value, but not on the
+  /// number of threads. It is rounded up to a multiple of 64 for the elements of a
+  /// <tt>std::vector<bool></tt>, which share words.
+  std::size_t chunk_size = 65536;
+
+  /// Gives each thread a single contiguous block of chunks instead of balancing them dynamically.
+  ///
+  /// On NUMA systems, with memory that has not been written yet (for example allocated with
+  /// <tt>new T[n]</tt> rather than a value-initialized <tt>std::vector</tt>), pages then land on
+  /// the node of the thread that will write them, and that later accesses partitioned the same way
+  /// will read locally.
+  bool first_touch = false;
+};
+
+} // namespace random
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Number of elements of the words shared by the elements that RandomIterator refers to: the
+/// chunks written by different threads must not split them.
+///
+/// The elements of a <tt>std::vector<bool></tt> are bits of words of at most 64 bits.
+template <class RandomIterator>
+struct chunk_granularity
+  : std::integral_constant<std::size_t,
+                           std::is_same<RandomIterator, std::vector<bool>::iterator>::value ? 64
+                                                                                            : 1> {
+};
+
+/// Calls <tt>generate(g, first + offset, count)</tt> on each chunk of \f$[first, first + n)\f$,
+/// with an engine seeded from the chunk's substream.
+template <class RandomIterator, class Generate>
+void parallel_fill(RandomIterator first,
+                   const std::size_t n,
+                   const std::uint64_t seed,
+                   const random::parallel_options &options,
+                   const Generate &generate)
+{
+  constexpr std::size_t granularity = chunk_granularity<RandomIterator>::value;
+  const std::size_t chunk
+    = (std::max<std::size_t>(options.chunk_size, 1) + granularity - 1) / granularity * granularity;
+  const std::size_t chunks = n / chunk + (n % chunk != 0 ? 1 : 0);
+  parallel_for(chunks, parallel_threads(options.threads, chunks), options.first_touch,
+               [&](const std::size_t c) {
+                 random::xoshiro256starstar_x8 g{substream_seed(seed, c)};
+                 const std::size_t offset = c * chunk;
+                 generate(g, first + offset, std::min(chunk, n - offset));
+               });
+}
+
+template <class RandomIterator>
+void parallel_fill(RandomIterator first,
+                   const std::size_t n,
+                   const std::uint64_t seed,
+                   const random::parallel_options &options)
+{
+  parallel_fill(first, n, seed, options,
+                [](random::xoshiro256starstar_x8 &g, RandomIterator it, const std::size_t count) {
+                  fill_chunk(g, it, count, is_bulk_fillable<RandomIterator>{});
+                });
+}
+
+template <class RandomIterator, class T>
+void parallel_fill(RandomIterator first,
+                   const std::size_t n,
+                   const T a,
+                   const T b,
+                   const std::uint64_t seed,
+                   const random::parallel_options &options)
+{
+  parallel_fill(first, n, seed, options,
+                [=](random::xoshiro256starstar_x8 &g, RandomIterator it, const std::size_t count) {
+                  fill_chunk(g, it, count, a, b, uniform_fill_method<T>{});
+                });
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
 namespace random {
 
 /// @name fill
@@ -33,12 +366,23 @@ namespace random {
 
 /// Fills a range with random values.
 ///
-/// Assigns each element in the range \f$[first, last)\f$ a random value. The values are generated
-/// with @ref abz::rand using default parameters.
+/// Assigns each element in the range \f$[first, last)\f$ a random value, drawn from the default
+/// interval of its type (see below for the floating point types).
 ///
 /// Note that each element is assigned a <b>different</b> value. If you want to assign all elements
 /// the same random value, use <tt>std::fill(first, last, abz::rand())</tt>.
 ///
+/// Ranges of @c float, @c double, integers and booleans are filled by a thread local @ref
+/// xoshiro256starstar_x8, whatever the container: the same seed gives the same values to a
+/// <tt>std::vector</tt> and to a <tt>std::deque</tt>. Floating point values are drawn from
+/// \f$[0, 1]\f$ as by <tt>abz::rand<double>()</tt>, and integers are the bytes of the engine's
+/// words (with the sign bits cleared), so bytes cost an eighth of a word each. Booleans take a bit of a word
+/// each. Contiguous ranges (pointers and <tt>std::vector</tt> iterators) are written in place
+/// using the widest vector instructions of the running CPU. The others, including the elements of
+/// a <tt>std::vector<bool></tt>, which are proxies to bits, are written through a buffer of the
+/// same words. The values of other types are drawn with @ref abz::rand from the thread local @ref
+/// default_engine.
+///
 /// @code
 /// std::vector<double> values(10);
 /// abz::random::fill(values.begin(), values.end());
@@ -49,8 +393,7 @@ namespace random {
 template <class ForwardIterator>
 inline void fill(ForwardIterator first, ForwardIterator last)
 {
-  using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
-  std::generate(first, last, []() { return abz::rand<value_type>(); });
+  _::fill(first, last, _::is_bulk_fillable<ForwardIterator>{});
 }
 
 /// Fills a container with random values.
@@ -65,12 +408,16 @@ inline void fill(ForwardIterator first, ForwardIterator last)
 template <class Container>
 inline void fill(Container &c)
 {
-  using value_type = typename Container::value_type;
-  std::generate(std::begin(c), std::end(c), []() { return abz::rand<value_type>(); });
+  fill(std::begin(c), std::end(c));
 }
 
 /// Fills a range with random values uniformly distributed on the interval \f$[a, b]\f$.
 ///
+/// The values are drawn from the engine of the vectorized path (see @ref xoshiro256starstar_x8).
+/// For integral types, the rejection threshold of the bounded sampling is computed once for the
+/// whole range. @c float and @c double values are converted from the engine's words in batches by
+/// the vectorized kernels of @ref uniform_real_distribution.
+///
 /// @code
 /// std::vector<double> values(10);
 /// abz::random::fill(values.begin(), values.end(), -1., 1.);
@@ -85,8 +432,7 @@ inline void fill(ForwardIterator first,
                  typename std::iterator_traits<ForwardIterator>::value_type a,
                  typename std::iterator_traits<ForwardIterator>::value_type b)
 {
-  using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
-  std::generate(first, last, [=]() { return abz::rand<value_type>(a, b); });
+  _::fill_n(first, std::distance(first, last), a, b);
 }
 
 /// Fills a container with random values uniformly distributed on the interval \f$[a, b]\f$.
@@ -102,8 +448,43 @@ inline void fill(ForwardIterator first,
 template <class Container>
 inline void fill(Container &c, typename Container::value_type a, typename Container::value_type b)
 {
-  using value_type = typename Container::value_type;
-  std::generate(std::begin(c), std::end(c), [=]() { return abz::rand<value_type>(a, b); });
+  fill(std::begin(c), std::end(c), a, b);
+}
+
+/// Fills a range with the coordinates of the next points of a quasi-random sequence.
+///
+/// The points are written one after another, so that the range holds whole blocks of points of
+/// @ref sobol_sequence, @ref halton_sequence or @ref r_sequence. When the size of the range is not
+/// a multiple of the number of dimensions, the last point is truncated and the sequence moves past
+/// it. The elements past the end of a finite sequence (see @ref sobol_sequence::max_points) are
+/// left unchanged.
+///
+/// @code
+/// abz::random::sobol_sequence sobol{3, seed};
+/// std::vector<double> points(3 * 1024);
+/// abz::random::fill(points.begin(), points.end(), sobol);
+/// @endcode
+///
+/// @param first, last The range of elements to assign a coordinate.
+/// @param [in,out] sequence The quasi-random sequence.
+/// @tparam ForwardIterator An iterator type that satisfies the ForwardIterator concept.
+template <class ForwardIterator, class Sequence>
+inline typename std::enable_if<is_quasi_random_sequence<Sequence>::value>::type fill(
+  ForwardIterator first, ForwardIterator last, Sequence &sequence)
+{
+  _::fill_points(sequence, first, static_cast<std::size_t>(std::distance(first, last)));
+}
+
+/// Fills a container with the coordinates of the next points of a quasi-random sequence.
+///
+/// @param [in,out] c A reference to the container to fill.
+/// @param [in,out] sequence The quasi-random sequence.
+/// @tparam Container A type that satisfies the Container concept.
+template <class Container, class Sequence>
+inline typename std::enable_if<is_quasi_random_sequence<Sequence>::value>::type fill(
+  Container &c, Sequence &sequence)
+{
+  fill(std::begin(c), std::end(c), sequence);
 }
 
 /// @} fill
@@ -114,12 +495,13 @@ inline void fill(Container &c, typename Container::value_type a, typename Contai
 
 /// Fills the first N elements of a range with random values.
 ///
-/// Assigns each element in the range \f$[first, first + count)\f$ a random value. The values are
-/// generated with @ref abz::rand using default parameters.
+/// Assigns each element in the range \f$[first, first + count)\f$ a random value.
 ///
 /// Note that each element is assigned a <b>different</b> value. If you want to assign all elements
 /// the same random value, use <tt>std::fill_n(first, count, abz::rand())</tt>.
 ///
+/// The values are drawn as by @ref fill(ForwardIterator, ForwardIterator).
+///
 /// @code
 /// std::vector<double> values(10);
 /// abz::random::fill_n(values.begin(), 10);
@@ -131,8 +513,7 @@ inline void fill(Container &c, typename Container::value_type a, typename Contai
 template <class OutputIterator, class Size>
 inline void fill_n(OutputIterator first, Size count)
 {
-  using value_type = typename std::iterator_traits<OutputIterator>::value_type;
-  std::generate_n(first, count, []() { return abz::rand<value_type>(); });
+  _::fill_n(first, count, _::is_bulk_fillable<OutputIterator>{});
 }
 
 /// Fills the first N elements of a range with random values uniformly distributed on the interval
@@ -153,12 +534,739 @@ inline void fill_n(OutputIterator first,
                    typename std::iterator_traits<OutputIterator>::value_type a,
                    typename std::iterator_traits<OutputIterator>::value_type b)
 {
-  using value_type = typename std::iterator_traits<OutputIterator>::value_type;
-  std::generate_n(first, count, [=]() { return abz::rand<value_type>(a, b); });
+  _::fill_n(first, count, a, b);
+}
+
+/// Fills the first N elements of a range with the coordinates of the next points of a quasi-random
+/// sequence, see @ref fill(ForwardIterator, ForwardIterator, Sequence &).
+///
+/// @param first The beginning of the range of elements to fill.
+/// @param count Number of elements to assign a coordinate to.
+/// @param [in,out] sequence The quasi-random sequence.
+/// @tparam OutputIterator An iterator type that satisfies the OutputIterator concept.
+template <class OutputIterator, class Size, class Sequence>
+inline typename std::enable_if<is_quasi_random_sequence<Sequence>::value>::type fill_n(
+  OutputIterator first, Size count, Sequence &sequence)
+{
+  if (count > 0) _::fill_points(sequence, first, static_cast<std::size_t>(count));
 }
 
 /// @} fill_n
 
+/// @name fill_bytes
+/// Filling raw memory with random bits.
+/// @{
+
+/// Fills @p size bytes of memory with random bits.
+///
+/// Every bit drawn from the engine is used: the 64-bit words of the thread local @ref
+/// xoshiro256starstar_x8 are generated in bulk and copied to @p buffer, at memory bandwidth.
+///
+/// @code
+/// std::vector<unsigned char> payload(1 << 20);
+/// abz::random::fill_bytes(payload.data(), payload.size());
+/// @endcode
+///
+/// @param buffer The memory to fill.
+/// @param size The number of bytes to fill.
+inline void fill_bytes(void *buffer, const std::size_t size)
+{
+  _::fill_bytes(_::thread_local_engine<xoshiro256starstar_x8>(),
+                static_cast<unsigned char *>(buffer), size);
+}
+
+/// @overload
+///
+/// Draws the bytes from @p g, in bulk when its output is made of 64-bit words and it has a
+/// <tt>generate(first, last)</tt> member.
+template <class Engine>
+inline void fill_bytes(void *buffer, const std::size_t size, Engine &g)
+{
+  _::fill_bytes(g, static_cast<unsigned char *>(buffer), size);
+}
+
+/// Sets the first @p bits bits of a bit-packed buffer to random values.
+///
+/// Bit \f$i\f$ is the bit \f$i \bmod 8\f$ (from the least significant one) of byte \f$i / 8\f$.
+/// The other bits of the last byte are left unchanged.
+///
+/// @param buffer The memory holding the bits.
+/// @param bits The number of bits to set.
+inline void fill_bits(void *buffer, const std::size_t bits)
+{
+  _::fill_bits(_::thread_local_engine<xoshiro256starstar_x8>(),
+               static_cast<unsigned char *>(buffer), bits);
+}
+
+/// @overload
+template <class Engine>
+inline void fill_bits(void *buffer, const std::size_t bits, Engine &g)
+{
+  _::fill_bits(g, static_cast<unsigned char *>(buffer), bits);
+}
+
+/// @} fill_bytes
+
+/// @name parallel_fill
+/// Filling a range with random numbers on several threads.
+/// @{
+
+/// Fills a range with random values on several threads.
+///
+/// The range is split into chunks of <tt>options.chunk_size</tt> elements. Each chunk is filled
+/// from its own substream, derived from @p seed and the chunk index, by a @ref
+/// xoshiro256starstar_x8 engine. Therefore the result only depends on @p seed and on the chunk
+/// size: it is bit-identical whatever the number of threads. Values follow the same distribution
+/// as with @ref fill(ForwardIterator, ForwardIterator).
+///
+/// The elements of a <tt>std::vector<bool></tt> are bits of shared words: @p first must then be
+/// at a multiple of 64 elements from the beginning of the vector, so that no word is split between
+/// two threads.
+///
+/// @code
+/// std::unique_ptr<double[]> values{new double[n]};
+/// abz::random::parallel_options options;
+/// options.first_touch = true;
+/// abz::random::parallel_fill(values.get(), values.get() + n, seed, options);
+/// @endcode
+///
+/// @param first, last The range of elements to assign a value.
+/// @param seed The seed of the stream.
+/// @param options The threads and chunks configuration.
+/// @tparam RandomIterator An iterator type that satisfies the RandomAccessIterator concept.
+template <class RandomIterator>
+inline void parallel_fill(RandomIterator first,
+                          RandomIterator last,
+                          const std::uint64_t seed,
+                          const parallel_options &options = parallel_options{})
+{
+  _::parallel_fill(first, static_cast<std::size_t>(last - first), seed, options);
+}
+
+/// Fills a container with random values on several threads.
+///
+/// @param [in,out] c A reference to the container to fill.
+/// @param seed The seed of the stream.
+/// @param options The threads and chunks configuration.
+/// @tparam Container A type that satisfies the ContiguousContainer concept.
+template <class Container>
+inline void parallel_fill(Container &c,
+                          const std::uint64_t seed,
+                          const parallel_options &options = parallel_options{})
+{
+  parallel_fill(std::begin(c), std::end(c), seed, options);
+}
+
+/// Fills a range with random values uniformly distributed on the interval \f$[a, b]\f$ on
+/// several threads.
+///
+/// @param first, last The range of elements to assign a value.
+/// @param a, b The interval of the generated numbers.
+/// @param seed The seed of the stream.
+/// @param options The threads and chunks configuration.
+/// @tparam RandomIterator An iterator type that satisfies the RandomAccessIterator concept.
+template <class RandomIterator>
+inline void parallel_fill(RandomIterator first,
+                          RandomIterator last,
+                          typename std::iterator_traits<RandomIterator>::value_type a,
+                          typename std::iterator_traits<RandomIterator>::value_type b,
+                          const std::uint64_t seed,
+                          const parallel_options &options = parallel_options{})
+{
+  _::parallel_fill(first, static_cast<std::size_t>(last - first), a, b, seed, options);
+}
+
+/// Fills the first N elements of a range with random values on several threads.
+///
+/// @param first The beginning of the range of elements to fill.
+/// @param count Number of elements to assign a value to.
+/// @param seed The seed of the stream.
+/// @param options The threads and chunks configuration.
+/// @tparam RandomIterator An iterator type that satisfies the RandomAccessIterator concept.
+template <class RandomIterator, class Size>
+inline void parallel_fill_n(RandomIterator first,
+                            Size count,
+                            const std::uint64_t seed,
+                            const parallel_options &options = parallel_options{})
+{
+  if (count > 0) _::parallel_fill(first, static_cast<std::size_t>(count), seed, options);
+}
+
+/// @} parallel_fill
+
+} // namespace random
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Checks whether Distribution has a <tt>generate(first, last, g, params)</tt> member usable with
+/// ForwardIterator.
+template <class Distribution, class Engine, class ForwardIterator, class = void>
+struct has_distribution_generate : std::false_type {
+};
+
+template <class Distribution, class Engine, class ForwardIterator>
+struct has_distribution_generate<
+  Distribution,
+  Engine,
+  ForwardIterator,
+  decltype(std::declval<const Distribution &>().generate(
+             std::declval<ForwardIterator>(),
+             std::declval<ForwardIterator>(),
+             std::declval<Engine &>(),
+             std::declval<const typename Distribution::param_type &>()),
+           void())>
+  : std::is_base_of<std::forward_iterator_tag,
+                    typename std::iterator_traits<ForwardIterator>::iterator_category> {
+};
+
+template <class Distribution, class Engine, class ForwardIterator>
+inline ForwardIterator rand_n(Distribution &d,
+                              Engine &g,
+                              ForwardIterator first,
+                              const std::size_t n,
+                              const typename Distribution::param_type &params,
+                              std::true_type)
+{
+  const ForwardIterator last = std::next(
+    first, static_cast<typename std::iterator_traits<ForwardIterator>::difference_type>(n));
+  d.generate(first, last, g, params);
+  return last;
+}
+
+template <class Distribution, class Engine, class OutputIterator>
+inline OutputIterator rand_n(Distribution &d,
+                             Engine &g,
+                             OutputIterator first,
+                             std::size_t n,
+                             const typename Distribution::param_type &params,
+                             std::false_type)
+{
+  for (; n != 0; --n, ++first) *first = d(g, params);
+  return first;
+}
+
+/// Generic batch: the generate() member of the distribution when it has one, a loop otherwise.
+template <class Distribution, class Engine, class OutputIterator>
+inline OutputIterator rand_n(Distribution &d,
+                             Engine &g,
+                             OutputIterator first,
+                             const std::size_t n,
+                             const typename Distribution::param_type &params)
+{
+  return rand_n(d, g, first, n, params,
+                has_distribution_generate<Distribution, Engine, OutputIterator>{});
+}
+
+// The standard distributions that abz has a kernel for.
+
+template <class Integral, class Engine, class OutputIterator>
+inline OutputIterator rand_n(std::uniform_int_distribution<Integral> &,
+                             Engine &g,
+                             OutputIterator first,
+                             const std::size_t n,
+                             const typename std::uniform_int_distribution<Integral>::param_type &params)
+{
+  const uniform_int_sampler<Integral> sampler{params.a(), params.b()};
+  return std::generate_n(first, n, [&]() { return sampler(g); });
+}
+
+template <class Real,
+          class Engine,
+          class OutputIterator,
+          class = typename std::enable_if<std::is_same<Real, float>::value
+                                          || std::is_same<Real, double>::value>::type>
+inline OutputIterator rand_n(std::uniform_real_distribution<Real> &,
+                             Engine &g,
+                             OutputIterator first,
+                             const std::size_t n,
+                             const typename std::uniform_real_distribution<Real>::param_type &params)
+{
+  return uniform_real_n<Real, random::interval::closed_open>(
+    g, first, n, make_uniform_real_scale<Real, random::interval::closed_open>(params.a(), params.b()));
+}
+
+template <class Real, class Engine, class OutputIterator>
+inline OutputIterator rand_n(std::normal_distribution<Real> &,
+                             Engine &g,
+                             OutputIterator first,
+                             const std::size_t n,
+                             const typename std::normal_distribution<Real>::param_type &params)
+{
+  const Real mean = params.mean(), stddev = params.stddev();
+  return ziggurat_generate_n<normal_ziggurat>(
+    g, first, n, [=](const double z) { return mean + stddev * static_cast<Real>(z); });
+}
+
+template <class Real, class Engine, class OutputIterator>
+inline OutputIterator rand_n(std::exponential_distribution<Real> &,
+                             Engine &g,
+                             OutputIterator first,
+                             const std::size_t n,
+                             const typename std::exponential_distribution<Real>::param_type &params)
+{
+  const Real beta = Real{1} / params.lambda();
+  return ziggurat_generate_n<exponential_ziggurat>(
+    g, first, n, [=](const double z) { return beta * static_cast<Real>(z); });
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @name rand_n
+/// Drawing many values from a distribution.
+/// @{
+
+/// Assigns @p count values drawn from a distribution to the range beginning at @p first.
+///
+/// A single instance of Distribution is used for the whole range. The batch is dispatched at
+/// compile time to:
+/// @li the <tt>generate(first, last, g, params)</tt> member of the distribution when it has one
+/// (e.g. @ref normal_distribution, @ref uniform_real_distribution) and @p first is a forward
+/// iterator;
+/// @li abz kernels for <tt>std::uniform_int_distribution</tt> (bounded sampling with a
+/// precomputed threshold), <tt>std::uniform_real_distribution</tt> (see @ref
+/// uniform_real_distribution), <tt>std::normal_distribution</tt> and
+/// <tt>std::exponential_distribution</tt> (Ziggurat). The values then follow the same
+/// distribution but differ from those of the standard library;
+/// @li a loop calling the distribution otherwise.
+///
+/// @code
+/// std::vector<double> noise(1 << 20);
+/// abz::random::rand_n<abz::random::normal_distribution<>>(engine, noise.begin(), noise.size(), 0., 2.);
+/// @endcode
+///
+/// @param g A reference to a random bit generator.
+/// @param first The beginning of the range of elements to assign a value.
+/// @param count Number of elements to assign a value to.
+/// @param params The distribution parameters.
+/// @return Iterator one past the last element assigned.
+///
+/// @tparam Distribution The statistical probability density function type
+/// (RandomNumberDistribution).
+/// @tparam Engine The random number generator type (UniformRandomBitGenerator).
+/// @tparam OutputIterator An iterator type that satisfies the OutputIterator concept.
+template <class Distribution, class Engine, class OutputIterator, class Size>
+inline OutputIterator rand_n(Engine &g,
+                             OutputIterator first,
+                             Size count,
+                             const typename Distribution::param_type &params)
+{
+  if (count <= 0) return first;
+  Distribution d{params};
+  return _::rand_n(d, g, first, static_cast<std::size_t>(count), params);
+}
+
+/// @overload
+///
+/// This overload takes standalone distribution parameters.
+template <class Distribution,
+          class Engine,
+          class OutputIterator,
+          class Size,
+          class... Params,
+          class = typename std::enable_if<all<std::is_arithmetic<Params>...>::value>::type>
+inline OutputIterator rand_n(Engine &g, OutputIterator first, Size count, Params &&... params)
+{
+  return rand_n<Distribution>(g, first, count,
+                              typename Distribution::param_type{std::forward<Params>(params)...});
+}
+
+/// @overload
+///
+/// This overload draws from @p d with its own parameters, so that its state is kept across batches.
+template <class Distribution, class Engine, class OutputIterator, class Size>
+inline OutputIterator rand_n(Engine &g, OutputIterator first, Size count, Distribution &d)
+{
+  if (count <= 0) return first;
+  return _::rand_n(d, g, first, static_cast<std::size_t>(count), d.param());
+}
+
+/// @} rand_n
+
+} // namespace random
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Draws an index of \f$[0, n)\f$ with a 32-bit word whenever @p n allows it.
+template <class Engine>
+inline std::size_t random_index(Engine &g, const std::size_t n)
+{
+  if (n <= 0xFFFFFFFFu) {
+    return static_cast<std::size_t>(bounded<std::uint32_t>(g, static_cast<std::uint32_t>(n)));
+  }
+  return static_cast<std::size_t>(bounded<std::uint64_t>(g, n));
+}
+
+/// Fisher-Yates shuffle of \f$[first, first + n)\f$.
+template <class RandomIterator, class Engine>
+void fisher_yates(RandomIterator first, const std::size_t n, Engine &g)
+{
+  for (std::size_t i = n; i > 1; --i) std::iter_swap(first + (i - 1), first + random_index(g, i));
+}
+
+/// Random bits drawn one at a time from 64-bit words.
+class random_bit_source {
+public:
+  template <class Engine>
+  bool operator()(Engine &g)
+  {
+    if (left_ == 0) {
+      word_ = random_bits<std::uint64_t>(g);
+      left_ = 64;
+    }
+    --left_;
+    const bool bit = (word_ & 1) != 0;
+    word_ >>= 1;
+    return bit;
+  }
+
+private:
+  std::uint64_t word_ = 0;
+  unsigned left_ = 0;
+};
+
+/// Elements that are cheaper to select without branches than to swap on a coin flip.
+template <class Iterator, class T = typename std::iterator_traits<Iterator>::value_type>
+struct is_selectable
+  : std::integral_constant<bool, std::is_trivially_copyable<T>::value && sizeof(T) <= 16> {
+};
+
+/// Runs the merge steps of merge_shuffle() while both sides have elements left. With selectable
+/// elements, the coin flip does not cost a mispredicted branch.
+template <class RandomIterator, class Engine>
+inline void merge_shuffle_steps(RandomIterator first,
+                                std::size_t &i,
+                                std::size_t &j,
+                                const std::size_t n,
+                                Engine &g,
+                                random_bit_source &coin,
+                                std::true_type)
+{
+  using value_type = typename std::iterator_traits<RandomIterator>::value_type;
+  for (; i < j && j < n; ++i) {
+    const bool bit = coin(g);
+    const value_type a = first[i], b = first[j];
+    first[i] = bit ? b : a;
+    first[j] = bit ? a : b;
+    j += bit ? 1 : 0;
+  }
+}
+
+template <class RandomIterator, class Engine>
+inline void merge_shuffle_steps(RandomIterator first,
+                                std::size_t &i,
+                                std::size_t &j,
+                                const std::size_t n,
+                                Engine &g,
+                                random_bit_source &coin,
+                                std::false_type)
+{
+  for (; i < j && j < n; ++i) {
+    if (coin(g)) std::iter_swap(first + i, first + j++);
+  }
+}
+
+/// MergeShuffle merge of the shuffled ranges \f$[first, first + m)\f$ and \f$[first + m, first +
+/// n)\f$ into a shuffled \f$[first, first + n)\f$.
+///
+/// Elements are taken from either side on coin flips, in place. Once a side runs out, the
+/// remaining elements are inserted at uniformly random positions among the ones before them.
+template <class RandomIterator, class Engine>
+void merge_shuffle(RandomIterator first, const std::size_t m, const std::size_t n, Engine &g)
+{
+  random_bit_source coin;
+  std::size_t i = 0, j = m;
+  merge_shuffle_steps(first, i, j, n, g, coin, is_selectable<RandomIterator>{});
+  for (;; ++i) {
+    if (coin(g)) {
+      if (j == n) break;
+      std::iter_swap(first + i, first + j);
+      ++j;
+    }
+    else if (i == j) {
+      break;
+    }
+  }
+  for (; i < n; ++i) std::iter_swap(first + i, first + random_index(g, i + 1));
+}
+
+template <class RandomIterator>
+void parallel_shuffle(RandomIterator first,
+                      const std::size_t n,
+                      const std::uint64_t seed,
+                      const random::parallel_options &options)
+{
+  const std::size_t block = std::max<std::size_t>(options.chunk_size, 1);
+  const std::size_t blocks = n / block + (n % block != 0 ? 1 : 0);
+  parallel_for(blocks, parallel_threads(options.threads, blocks), options.first_touch,
+               [&](const std::size_t b) {
+                 random::xoshiro256starstar g{substream_seed(substream_seed(seed, 0), b)};
+                 const std::size_t offset = b * block;
+                 fisher_yates(first + offset, std::min(block, n - offset), g);
+               });
+  std::size_t level = 1;
+  for (std::size_t width = block; width < n; width *= 2, ++level) {
+    const std::size_t pairs = n / (2 * width) + (n % (2 * width) > width ? 1 : 0);
+    parallel_for(pairs, parallel_threads(options.threads, pairs), options.first_touch,
+                 [&](const std::size_t p) {
+                   random::xoshiro256starstar g{substream_seed(substream_seed(seed, level), p)};
+                   const std::size_t offset = 2 * width * p;
+                   merge_shuffle(first + offset, width, std::min(2 * width, n - offset), g);
+                 });
+  }
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @name shuffle
+/// Randomly reordering a range.
+/// @{
+
+/// Reorders the elements of \f$[first, last)\f$ with a uniformly random permutation.
+///
+/// Fisher-Yates shuffle drawing its indices with Lemire's nearly divisionless bounded sampling,
+/// from 32-bit words as long as the range allows it.
+///
+/// @param first, last The range of elements to shuffle.
+/// @param g A reference to a random bit generator.
+/// @tparam RandomIterator An iterator type that satisfies the RandomAccessIterator concept.
+/// @tparam Engine The random number generator type (UniformRandomBitGenerator).
+template <class RandomIterator, class Engine>
+inline void shuffle(RandomIterator first, RandomIterator last, Engine &g)
+{
+  if (last - first > 1) _::fisher_yates(first, static_cast<std::size_t>(last - first), g);
+}
+
+/// @overload
+///
+/// This overload uses the thread local engine of the vectorized path (see @ref fill).
+template <class RandomIterator>
+inline void shuffle(RandomIterator first, RandomIterator last)
+{
+  shuffle(first, last, _::thread_local_engine<xoshiro256starstar_x8>());
+}
+
+/// Reorders the elements of \f$[first, last)\f$ with a uniformly random permutation, on several
+/// threads.
+///
+/// MergeShuffle: blocks of <tt>options.chunk_size</tt> elements are shuffled independently, in
+/// cache, then merged pairwise level by level. A merge draws one random bit per element and
+/// accesses memory sequentially, and the merges of a level are independent, so the work spreads
+/// over the threads where the random accesses of Fisher-Yates cannot. On a single thread, @ref
+/// shuffle is faster. Each block and merge draws from its own substream of @p seed: the result only
+/// depends on @p seed and on the block size, not on the number of threads.
+///
+/// @code
+/// std::vector<std::uint32_t> ids(n);
+/// std::iota(ids.begin(), ids.end(), 0);
+/// abz::random::parallel_shuffle(ids.begin(), ids.end(), seed);
+/// @endcode
+///
+/// @param first, last The range of elements to shuffle.
+/// @param seed The seed of the stream.
+/// @param options The threads and blocks configuration.
+/// @tparam RandomIterator An iterator type that satisfies the RandomAccessIterator concept.
+///
+/// @reference A. Bacher, O. Bodini, A. Hollender, J. Lumbroso. MergeShuffle: a very fast,
+/// parallel random permutation algorithm. 2015.
+template <class RandomIterator>
+inline void parallel_shuffle(RandomIterator first,
+                             RandomIterator last,
+                             const std::uint64_t seed,
+                             const parallel_options &options = parallel_options{})
+{
+  if (last - first > 1) {
+    _::parallel_shuffle(first, static_cast<std::size_t>(last - first), seed, options);
+  }
+}
+
+/// @} shuffle
+
+} // namespace random
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Returns a value of \f$(0, 1)\f$ drawn from @p g.
+template <class Engine>
+inline double open_unit(Engine &g)
+{
+  return canonical(random_bits<std::uint64_t>(g),
+                   canonical_traits<double, random::interval::open>::params());
+}
+
+/// Returns \f$\lfloor x \rfloor\f$, saturated to the range of std::size_t.
+inline std::size_t saturated_floor(const double x) noexcept
+{
+  return x < static_cast<double>(std::numeric_limits<std::size_t>::max())
+           ? static_cast<std::size_t>(x)
+           : std::numeric_limits<std::size_t>::max();
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @name sample
+/// Sampling without replacement.
+/// @{
+
+/// Selects @p k elements of \f$[first, last)\f$ uniformly at random, in a single pass.
+///
+/// Reservoir sampling with geometric jumps (Li's Algorithm L): after the first @p k elements, the
+/// number of elements to skip before the next replacement is drawn directly, so that only
+/// \f$O(k (1 + \log(n / k)))\f$ random numbers are drawn for a stream of \f$n\f$ elements. The
+/// stream is read once and does not need to be held in memory, nor its length known.
+///
+/// The selected elements are not in the order of the stream.
+///
+/// @code
+/// std::vector<std::string> lines(100);
+/// std::ifstream log{"requests.log"};
+/// const auto end = abz::random::sample(std::istream_iterator<std::string>{log},
+///                                      std::istream_iterator<std::string>{}, lines.begin(),
+///                                      lines.size(), engine);
+/// @endcode
+///
+/// @param first, last The stream of elements to select from.
+/// @param out The beginning of the reservoir, of at least @p k elements.
+/// @param k The number of elements to select.
+/// @param g A reference to a random bit generator.
+/// @return The end of the selected elements: <tt>out + min(k, n)</tt>.
+///
+/// @tparam InputIterator An iterator type that satisfies the InputIterator concept.
+/// @tparam RandomIterator An iterator type that satisfies the RandomAccessIterator concept.
+/// @tparam Engine The random number generator type (UniformRandomBitGenerator).
+///
+/// @reference K.-H. Li. Reservoir-sampling algorithms of time complexity O(n(1 + log(N/n))). ACM
+/// Transactions on Mathematical Software, 1994.
+template <class InputIterator, class RandomIterator, class Size, class Engine>
+RandomIterator sample(InputIterator first, InputIterator last, RandomIterator out, Size k, Engine &g)
+{
+  if (k <= 0) return out;
+  const std::size_t n = static_cast<std::size_t>(k);
+  std::size_t filled = 0;
+  for (; filled < n && first != last; ++first, ++filled) out[filled] = *first;
+  if (first == last) return out + filled;
+
+  const double inverse_k = 1. / static_cast<double>(n);
+  double w = std::exp(std::log(_::open_unit(g)) * inverse_k);
+  for (;;) {
+    for (std::size_t skip = _::saturated_floor(std::log(_::open_unit(g)) / std::log1p(-w));
+         skip != 0; --skip) {
+      if (++first == last) return out + filled;
+    }
+    out[_::random_index(g, n)] = *first;
+    if (++first == last) return out + filled;
+    w *= std::exp(std::log(_::open_unit(g)) * inverse_k);
+  }
+}
+
+/// @overload
+///
+/// This overload uses the thread local engine of the vectorized path (see @ref fill).
+template <class InputIterator, class RandomIterator, class Size>
+inline RandomIterator sample(InputIterator first, InputIterator last, RandomIterator out, Size k)
+{
+  return sample(first, last, out, k, _::thread_local_engine<xoshiro256starstar_x8>());
+}
+
+/// Writes @p k distinct indices of \f$[0, n)\f$ selected uniformly at random to @p out.
+///
+/// Floyd's algorithm: exactly @p k bounded integers are drawn, with a hash set of the selected
+/// indices, whatever the size of @p n. The indices are not sorted, see sorted_sample_indices().
+///
+/// @param n The number of indices to select from.
+/// @param k The number of indices to select, clamped to @p n.
+/// @param out The beginning of the range of indices to assign, of type Size.
+/// @param g A reference to a random bit generator.
+/// @return Iterator one past the last index assigned, i.e. after <tt>min(k, n)</tt> indices.
+///
+/// @reference J. Bentley, B. Floyd. Programming pearls: a sample of brilliance. Communications of
+/// the ACM, 1987.
+template <class Size, class Count, class OutputIterator, class Engine>
+OutputIterator sample_indices(const Size n, const Count k, OutputIterator out, Engine &g)
+{
+  if (n <= 0 || k <= 0) return out;
+  const std::size_t size = static_cast<std::size_t>(n);
+  const std::size_t count = std::min(static_cast<std::size_t>(k), size);
+  std::unordered_set<std::size_t> selected;
+  selected.reserve(count);
+  for (std::size_t j = size - count; j < size; ++j) {
+    const std::size_t t = _::random_index(g, j + 1);
+    const std::size_t index = selected.count(t) == 0 ? t : j;
+    selected.insert(index);
+    *out++ = static_cast<Size>(index);
+  }
+  return out;
+}
+
+/// @overload
+///
+/// This overload uses the thread local engine of the vectorized path (see @ref fill).
+template <class Size, class Count, class OutputIterator>
+inline OutputIterator sample_indices(const Size n, const Count k, OutputIterator out)
+{
+  return sample_indices(n, k, out, _::thread_local_engine<xoshiro256starstar_x8>());
+}
+
+/// Writes @p k distinct indices of \f$[0, n)\f$ selected uniformly at random to @p out, in
+/// increasing order.
+///
+/// Vitter's Method A: the gaps between consecutive indices are drawn sequentially, with a single
+/// uniform per index and no memory, so the indices can be consumed as they are generated (e.g. to
+/// select records while reading a file). The running time is \f$O(n)\f$.
+///
+/// @param n The number of indices to select from.
+/// @param k The number of indices to select, clamped to @p n.
+/// @param out The beginning of the range of indices to assign, of type Size.
+/// @param g A reference to a random bit generator.
+/// @return Iterator one past the last index assigned, i.e. after <tt>min(k, n)</tt> indices.
+///
+/// @reference J. S. Vitter. Faster methods for random sampling. Communications of the ACM, 1984.
+template <class Size, class Count, class OutputIterator, class Engine>
+OutputIterator sorted_sample_indices(const Size n, const Count k, OutputIterator out, Engine &g)
+{
+  if (n <= 0 || k <= 0) return out;
+  std::size_t remaining = static_cast<std::size_t>(n);
+  std::size_t count = std::min(static_cast<std::size_t>(k), remaining);
+  std::size_t index = 0;
+  for (; count > 1; --count, --remaining, ++index) {
+    // Skips s records with probability prod_{i < s} (remaining - count - i) / (remaining - i).
+    const double v = _::open_unit(g);
+    std::size_t top = remaining - count;
+    double quotient = static_cast<double>(top) / static_cast<double>(remaining);
+    while (quotient > v) {
+      ++index;
+      --remaining;
+      --top;
+      quotient *= static_cast<double>(top) / static_cast<double>(remaining);
+    }
+    *out++ = static_cast<Size>(index);
+  }
+  *out++ = static_cast<Size>(index + _::random_index(g, remaining));
+  return out;
+}
+
+/// @overload
+///
+/// This overload uses the thread local engine of the vectorized path (see @ref fill).
+template <class Size, class Count, class OutputIterator>
+inline OutputIterator sorted_sample_indices(const Size n, const Count k, OutputIterator out)
+{
+  return sorted_sample_indices(n, k, out, _::thread_local_engine<xoshiro256starstar_x8>());
+}
+
+/// @} sample
+
 } // namespace random
 
 ABZ_NAMESPACE_END
@@ -0,0 +1,359 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_alias_distribution_hpp
+#define abz_random_alias_distribution_hpp
+
+/// @file abz/random/alias_distribution.hpp
+/// Weighted discrete distribution sampled with an alias table.
+///
+/// @reference M. D. Vose. A linear algorithm for generating random numbers with a given
+/// distribution. IEEE Transactions on Software Engineering, 1991.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+#include "abz/random/detail/uniform_int.hpp"
+#include "abz/random/uniform_real_distribution.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <istream>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class alias_distribution
+/// @brief Integers of \f$[0, n)\f$ drawn with probabilities proportional to weights.
+///
+/// Satisfies the RandomNumberDistribution concept and can replace
+/// <tt>std::discrete_distribution</tt>. The weights are turned into an alias table in \f$O(n)\f$
+/// when the parameters are built. Drawing a value then costs \f$O(1)\f$: a single 64-bit word
+/// selects a column of the table (high half of its product by \f$n\f$) and chooses between the
+/// column and its alias (low half), with a bias below \f$n \cdot 2^{-64}\f$.
+///
+/// Weights can be changed with update() without rebuilding the table: a decreased weight is
+/// honoured by rejecting the draws of its value with the right probability (thinning against the
+/// weights the table was built from). The table is rebuilt when a weight exceeds the one it was
+/// built from, or when the expected acceptance rate falls below \f$1/2\f$, so that a draw costs
+/// less than two tries on average.
+///
+/// generate() fills whole ranges at once with words drawn in bulk.
+///
+/// @code
+/// abz::random::alias_distribution<int> d{1., 2., 7.};
+/// std::vector<int> picks(4096);
+/// d.generate(picks.begin(), picks.end(), engine);
+/// d.update(2, 5.); // O(1)
+/// @endcode
+///
+/// @tparam IntType An integral type.
+template <class IntType = int>
+class alias_distribution {
+  static_assert(std::is_integral<IntType>::value, "IntType must be an integral type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = IntType; ///< The integral type generated.
+
+  /// The parameters of the distribution: the weights and their alias table.
+  class param_type {
+  public:
+    using distribution_type = alias_distribution;
+
+    /// A single value of weight 1.
+    param_type() : param_type({1.}) {}
+
+    /// Builds the table of the weights \f$[first, last)\f$. The weights must be finite,
+    /// non-negative and not all null.
+    template <class InputIterator>
+    param_type(InputIterator first, InputIterator last)
+      : weights_(first, last)
+    {
+      if (weights_.empty()) weights_.push_back(1.);
+      build();
+    }
+
+    param_type(std::initializer_list<double> weights)
+      : param_type(weights.begin(), weights.end())
+    {
+    }
+
+    /// Returns the number of values.
+    std::size_t size() const noexcept { return weights_.size(); }
+
+    /// Returns the current weights.
+    const std::vector<double> &weights() const noexcept { return weights_; }
+
+    /// Returns the probabilities of the values.
+    std::vector<double> probabilities() const
+    {
+      std::vector<double> p(weights_);
+      for (double &w : p) w /= total_;
+      return p;
+    }
+
+    /// Sets the weight of value @p i to @p weight.
+    ///
+    /// Amortized \f$O(1)\f$ when the weight decreases, \f$O(n)\f$ when the table is rebuilt.
+    void update(const std::size_t i, const double weight)
+    {
+      total_ += weight - weights_[i];
+      weights_[i] = weight;
+      if (weight > envelope_[i] || 2 * total_ < envelope_total_) {
+        build();
+        return;
+      }
+      // A null envelope, never picked, would give 0 / 0.
+      thinning_[i] = envelope_[i] != 0. ? weight / envelope_[i] : 0.;
+      thinned_ = true;
+      generation_ = next_generation();
+    }
+
+    /// Compares the weights. The copies of a parameter set that was not updated since share its
+    /// generation, and compare equal in \f$O(1)\f$: e.g. the parameters given again and again to
+    /// @ref abz::rand.
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.generation_ == rhs.generation_ || lhs.weights_ == rhs.weights_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class alias_distribution;
+
+    /// Vose's construction: columns are filled by pairing an underfull value with an overfull one.
+    void build()
+    {
+      generation_ = next_generation();
+      const std::size_t n = weights_.size();
+      total_ = std::accumulate(weights_.begin(), weights_.end(), 0.);
+      envelope_ = weights_;
+      envelope_total_ = total_;
+      thinning_.assign(n, 1.);
+      thinned_ = false;
+      threshold_.assign(n, std::numeric_limits<std::uint64_t>::max());
+      alias_.resize(n);
+
+      std::vector<double> scaled(n);
+      std::vector<std::size_t> small, large;
+      for (std::size_t i = 0; i < n; ++i) {
+        alias_[i] = i;
+        scaled[i] = weights_[i] * static_cast<double>(n) / total_;
+        (scaled[i] < 1. ? small : large).push_back(i);
+      }
+      while (!small.empty() && !large.empty()) {
+        const std::size_t s = small.back(), l = large.back();
+        small.pop_back();
+        threshold_[s] = to_threshold(scaled[s]);
+        alias_[s] = l;
+        scaled[l] = (scaled[l] + scaled[s]) - 1.;
+        if (scaled[l] < 1.) {
+          large.pop_back();
+          small.push_back(l);
+        }
+      }
+      // The remaining columns are full up to rounding errors: they never use their alias.
+    }
+
+    /// Returns an identifier of the weights, unique to the process.
+    static std::uint64_t next_generation() noexcept
+    {
+      static std::atomic<std::uint64_t> generations{0};
+      return generations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static std::uint64_t to_threshold(const double p) noexcept
+    {
+      return p >= 1. ? std::numeric_limits<std::uint64_t>::max()
+                     : static_cast<std::uint64_t>(p * 18446744073709551616.);
+    }
+
+    /// Selects a value of the table from a word.
+    std::size_t pick(const std::uint64_t w) const noexcept
+    {
+      std::uint64_t lo;
+      const std::size_t j
+        = static_cast<std::size_t>(_::mulhilo(w, static_cast<std::uint64_t>(size()), lo));
+      return lo < threshold_[j] ? j : alias_[j];
+    }
+
+    /// Whether a picked value is kept, drawing from @p g only for the values that are thinned.
+    template <class Engine>
+    bool accept(Engine &g, const std::size_t i) const
+    {
+      return thinning_[i] >= 1.
+             || _::canonical(_::random_bits<std::uint64_t>(g),
+                             _::canonical_traits<double, interval::closed_open>::params())
+                  < thinning_[i];
+    }
+
+    template <class Engine>
+    std::size_t sample(Engine &g) const
+    {
+      for (;;) {
+        const std::size_t i = pick(_::random_bits<std::uint64_t>(g));
+        if (!thinned_ || accept(g, i)) return i;
+      }
+    }
+
+    std::vector<double> weights_;
+    std::vector<double> envelope_; // Weights the table was built from.
+    std::vector<double> thinning_; // Acceptance probabilities, weights_ / envelope_.
+    std::vector<std::uint64_t> threshold_;
+    std::vector<std::size_t> alias_;
+    double total_;
+    double envelope_total_;
+    bool thinned_;
+    std::uint64_t generation_; // Shared by the copies of the same weights.
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  alias_distribution() = default;
+
+  template <class InputIterator>
+  alias_distribution(InputIterator first, InputIterator last)
+    : p_(first, last)
+  {
+  }
+
+  alias_distribution(std::initializer_list<double> weights) : p_(weights) {}
+
+  explicit alias_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// Sets the weight of value @p i to @p weight, see param_type::update().
+  void update(const std::size_t i, const double weight) { p_.update(i, weight); }
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return static_cast<result_type>(p.sample(g));
+  }
+
+  /// Fills \f$[first, last)\f$ with values drawn from the distribution.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values drawn from the distribution of parameters @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    constexpr std::size_t chunk = 256;
+    alignas(64) std::uint64_t words[chunk];
+    for (std::size_t n = static_cast<std::size_t>(std::distance(first, last)); n != 0;) {
+      const std::size_t m = std::min(chunk, n);
+      _::random_words(g, words, m);
+      for (std::size_t k = 0; k < m; ++k, ++first) {
+        std::size_t i = p.pick(words[k]);
+        if (p.thinned_ && !p.accept(g, i)) i = p.sample(g);
+        *first = static_cast<result_type>(i);
+      }
+      n -= m;
+    }
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  std::vector<double> probabilities() const { return p_.probabilities(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return 0; }
+  result_type max() const noexcept { return static_cast<result_type>(p_.size() - 1); }
+
+  /// @}
+
+  friend bool operator==(const alias_distribution &lhs, const alias_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const alias_distribution &lhs, const alias_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const alias_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+    os << d.p_.size();
+    for (const double w : d.p_.weights()) os << os.widen(' ') << w;
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       alias_distribution &d)
+  {
+    std::size_t n;
+    if (!(is >> n)) return is;
+    std::vector<double> weights(n);
+    for (double &w : weights) {
+      if (!(is >> w)) return is;
+    }
+    d.param(param_type(weights.begin(), weights.end()));
+    return is;
+  }
+
+private:
+  param_type p_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_alias_distribution_hpp
@@ -0,0 +1,303 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_binomial_distribution_hpp
+#define abz_random_binomial_distribution_hpp
+
+/// @file abz/random/binomial_distribution.hpp
+/// Binomial distribution sampled with the BTRD method.
+///
+/// @reference W. Hörmann. The generation of binomial random variates. Journal of Statistical
+/// Computation and Simulation, 1993.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/discrete.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class binomial_distribution
+/// @brief Binomial distribution sampled with the BTRD method.
+///
+/// Satisfies the RandomNumberDistribution concept and can replace
+/// <tt>std::binomial_distribution</tt>. When \f$t \min(p, 1 - p) \geq 10\f$, values are sampled
+/// with Hörmann's transformed rejection with decomposition (BTRD): most of them are accepted from
+/// a single uniform, and the others by a short product of ratios or a squeeze, rarely reaching the
+/// logarithms of the exact test. Smaller means are sampled by inversion, with a single uniform.
+/// Probabilities above \f$1/2\f$ are sampled as \f$t - X\f$, \f$X\f$ of probability \f$1 - p\f$.
+///
+/// The constants of both methods are computed when the parameters are built: keep the param_type
+/// (or the distribution) around when drawing many values with the same parameters. generate()
+/// fills whole ranges at once with words drawn in bulk.
+///
+/// @tparam IntType An integral type.
+template <class IntType = int>
+class binomial_distribution {
+  static_assert(std::is_integral<IntType>::value, "IntType must be an integral type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = IntType; ///< The integral type generated.
+
+  /// The parameters of the distribution.
+  class param_type {
+  public:
+    using distribution_type = binomial_distribution;
+
+    explicit param_type(const IntType t = 1, const double p = .5)
+      : t_(t)
+      , p_(p)
+      , flip_(p > .5)
+    {
+      const double n = static_cast<double>(t);
+      const double q = flip_ ? 1 - p : p; // The probability sampled, at most 1/2.
+      r_ = q / (1 - q);
+      nr_ = (n + 1) * r_;
+      if (n * q < btrd_threshold) {
+        s_ = std::pow(1 - q, n);
+        return;
+      }
+      btrd_ = true;
+      m_ = std::floor((n + 1) * q);
+      npq_ = n * q * (1 - q);
+      const double sqrt_npq = std::sqrt(npq_);
+      b_ = 1.15 + 2.53 * sqrt_npq;
+      a_ = -.0873 + .0248 * b_ + .01 * q;
+      c_ = n * q + .5;
+      alpha_ = (2.83 + 5.1 / b_) * sqrt_npq;
+      vr_ = .92 - 4.2 / b_;
+      urvr_ = .86 * vr_;
+      const double nm = n - m_ + 1;
+      h_ = (m_ + .5) * std::log((m_ + 1) / (r_ * nm)) + _::stirling_correction(m_)
+           + _::stirling_correction(n - m_);
+    }
+
+    IntType t() const noexcept { return t_; }
+    double p() const noexcept { return p_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.t_ == rhs.t_ && lhs.p_ == rhs.p_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class binomial_distribution;
+
+    IntType t_;
+    double p_;
+    bool flip_;
+    bool btrd_ = false;
+    double r_;        // q / (1 - q).
+    double nr_;       // (t + 1) r.
+    double s_ = 0.;   // Inversion: (1 - q)^t, the probability of 0.
+    double m_ = 0.;   // BTRD: the mode.
+    double npq_ = 0.;
+    double a_ = 0.;
+    double b_ = 0.;
+    double c_ = 0.;
+    double alpha_ = 0.;
+    double vr_ = 0.;
+    double urvr_ = 0.;
+    double h_ = 0.;
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  binomial_distribution() : binomial_distribution(1) {}
+
+  explicit binomial_distribution(const IntType t, const double p = .5) : p_(t, p) {}
+
+  explicit binomial_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return sample(g, p);
+  }
+
+  /// Fills \f$[first, last)\f$ with binomially distributed values.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values following the distribution of parameters @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    _::generate_buffered(first, last, g,
+                         [&p](_::word_buffer<Engine> &w) { return sample(w, p); });
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  IntType t() const noexcept { return p_.t(); }
+  double p() const noexcept { return p_.p(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return 0; }
+  result_type max() const noexcept { return p_.t(); }
+
+  /// @}
+
+  friend bool operator==(const binomial_distribution &lhs, const binomial_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const binomial_distribution &lhs, const binomial_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const binomial_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+    const CharT space = os.widen(' ');
+    os << d.t() << space << d.p();
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       binomial_distribution &d)
+  {
+    IntType t;
+    double p;
+    if (is >> t >> p) d.param(param_type{t, p});
+    return is;
+  }
+
+private:
+  /// The smallest \f$t \min(p, 1 - p)\f$ sampled with BTRD.
+  static constexpr double btrd_threshold = 10.;
+
+  template <class Engine>
+  static result_type sample(Engine &g, const param_type &p)
+  {
+    const IntType k = p.btrd_ ? btrd(g, p) : inversion(g, p);
+    return p.flip_ ? static_cast<result_type>(p.t_ - k) : k;
+  }
+
+  /// Sequential search of the inverse of the distribution function.
+  template <class Engine>
+  static result_type inversion(Engine &g, const param_type &p)
+  {
+    for (;;) {
+      double u = _::unit_open(g), f = p.s_;
+      for (result_type k = 0;; f *= p.nr_ / ++k - p.r_) {
+        if (u <= f) return k;
+        if (k == p.t_) break;
+        u -= f;
+      }
+      // The rounding errors left u beyond the distribution function: draw again.
+    }
+  }
+
+  template <class Engine>
+  static result_type btrd(Engine &g, const param_type &p)
+  {
+    const double n = static_cast<double>(p.t_);
+    for (;;) {
+      double v = _::unit_open(g), u;
+      if (v <= p.urvr_) {
+        u = v / p.vr_ - .43;
+        return static_cast<result_type>(
+          std::floor((2 * p.a_ / (.5 - std::fabs(u)) + p.b_) * u + p.c_));
+      }
+      if (v >= p.vr_) {
+        u = _::unit_open(g) - .5;
+      } else {
+        u = v / p.vr_ - .93;
+        u = std::copysign(.5, u) - u;
+        v = _::unit_open(g) * p.vr_;
+      }
+      const double us = .5 - std::fabs(u);
+      const double k = std::floor((2 * p.a_ / us + p.b_) * u + p.c_);
+      if (k < 0 || k > n) continue;
+      v *= p.alpha_ / (p.a_ / (us * us) + p.b_);
+      const double km = std::fabs(k - p.m_);
+      if (km <= 15) {
+        // f(k) / f(m) by recursion.
+        double f = 1.;
+        for (double i = p.m_ + 1; i <= k; ++i) f *= p.nr_ / i - p.r_;
+        for (double i = k + 1; i <= p.m_; ++i) v *= p.nr_ / i - p.r_;
+        if (v <= f) return static_cast<result_type>(k);
+        continue;
+      }
+      // Squeeze with bounds of log(f(k) / f(m)).
+      v = std::log(v);
+      const double rho = km / p.npq_ * (((km / 3 + .625) * km + 1. / 6) / p.npq_ + .5);
+      const double t = -km * km / (2 * p.npq_);
+      if (v < t - rho) return static_cast<result_type>(k);
+      if (v > t + rho) continue;
+      const double nm = n - p.m_ + 1, nk = n - k + 1;
+      if (v <= p.h_ + (n + 1) * std::log(nm / nk) + (k + .5) * std::log(nk * p.r_ / (k + 1))
+                 - _::stirling_correction(k) - _::stirling_correction(n - k)) {
+        return static_cast<result_type>(k);
+      }
+    }
+  }
+
+  param_type p_;
+};
+
+template <class IntType>
+constexpr double binomial_distribution<IntType>::btrd_threshold;
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_binomial_distribution_hpp
@@ -0,0 +1,207 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_buffered_engine_hpp
+#define abz_random_buffered_engine_hpp
+
+/// @file abz/random/buffered_engine.hpp
+/// Engine adaptor generating its output in blocks.
+
+#include "abz/detail/macros.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+ABZ_NAMESPACE_BEGIN
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Checks whether Engine has a <tt>generate(result_type *, result_type *)</tt> member.
+template <class Engine, class = void>
+struct has_generate : std::false_type {
+};
+
+template <class Engine>
+struct has_generate<Engine,
+                    decltype(std::declval<Engine &>().generate(
+                               std::declval<typename Engine::result_type *>(),
+                               std::declval<typename Engine::result_type *>()),
+                             void())> : std::true_type {
+};
+
+template <class Engine>
+inline void generate(Engine &e,
+                     typename Engine::result_type *first,
+                     typename Engine::result_type *last,
+                     std::true_type)
+{
+  e.generate(first, last);
+}
+
+template <class Engine>
+inline void generate(Engine &e,
+                     typename Engine::result_type *first,
+                     typename Engine::result_type *last,
+                     std::false_type)
+{
+  for (; first != last; ++first) *first = e();
+}
+
+/// Fills \f$[first, last)\f$ with the next outputs of @p e, in bulk when the engine supports it.
+template <class Engine>
+inline void generate(Engine &e, typename Engine::result_type *first, typename Engine::result_type *last)
+{
+  generate(e, first, last, has_generate<Engine>{});
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @class buffered_engine
+/// @brief An engine adaptor that generates the outputs of its engine in blocks.
+///
+/// Satisfies the UniformRandomBitGenerator concept and produces exactly the same sequence as the
+/// adapted engine. The outputs are generated @p BufferSize at a time into a cache line aligned
+/// buffer, with the engine's bulk <tt>generate(first, last)</tt> member when it has one (e.g.
+/// @ref xoshiro256starstar_x8), then handed out one by one.
+///
+/// The adaptor is opt-in: none of the thread local engines of the library is buffered unless it
+/// is named explicitly. Using it as the engine of the thread local overloads gives the scalar @ref
+/// abz::rand calls the throughput of the vectorized kernels:
+///
+/// @code
+/// using engine = abz::random::buffered_engine<abz::random::xoshiro256starstar_x8>;
+/// abz::rand<double, engine>();
+/// @endcode
+///
+/// or, library-wide, by defining @c ABZ_RANDOM_DEFAULT_ENGINE to
+/// <tt>abz::random::buffered_engine<abz::random::xoshiro256starstar_x8></tt>.
+///
+/// @tparam Engine The adapted engine type.
+/// @tparam BufferSize The number of outputs generated at once.
+template <class Engine, std::size_t BufferSize = 128>
+class buffered_engine {
+  static_assert(BufferSize > 0, "The buffer size must be positive");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using engine_type = Engine;                          ///< The adapted engine type.
+  using result_type = typename Engine::result_type; ///< The integer type generated.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr std::size_t buffer_size = BufferSize; ///< The number of outputs per refill.
+
+  /// @}
+
+  /// @name Construction and seeding
+  /// @{
+
+  buffered_engine() = default;
+
+  /// Constructs the adapted engine from @p args. Only takes part in overload resolution when
+  /// Engine is constructible from them and they are not a single buffered_engine, so that the
+  /// copies go through the copy constructor and the traits see the constructors of Engine.
+  template <class Arg,
+            class... Args,
+            class = typename std::enable_if<
+              std::is_constructible<Engine, Arg &&, Args &&...>::value
+              && !std::is_same<typename std::decay<Arg>::type, buffered_engine>::value>::type>
+  explicit buffered_engine(Arg &&arg, Args &&... args)
+    : e_(std::forward<Arg>(arg), std::forward<Args>(args)...)
+  {
+  }
+
+  /// Reseeds the adapted engine with @p args and discards the buffered outputs.
+  template <class... Args>
+  void seed(Args &&... args)
+  {
+    e_.seed(std::forward<Args>(args)...);
+    index_ = BufferSize;
+  }
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  static constexpr result_type min() { return Engine::min(); }
+  static constexpr result_type max() { return Engine::max(); }
+
+  /// Returns the next output.
+  result_type operator()()
+  {
+    if (index_ == BufferSize) refill();
+    return buffer_[index_++];
+  }
+
+  /// Advances the engine by @p z outputs.
+  void discard(unsigned long long z)
+  {
+    const std::size_t available = BufferSize - index_;
+    if (z <= available) {
+      index_ += static_cast<std::size_t>(z);
+      return;
+    }
+    e_.discard(z - available);
+    index_ = BufferSize;
+  }
+
+  /// @}
+
+  /// Returns the adapted engine. Its state is ahead of this adaptor by the buffered outputs.
+  const Engine &base() const noexcept { return e_; }
+
+  friend bool operator==(const buffered_engine &lhs, const buffered_engine &rhs)
+  {
+    if (lhs.e_ != rhs.e_ || lhs.index_ != rhs.index_) return false;
+    for (std::size_t i = lhs.index_; i < BufferSize; ++i) {
+      if (lhs.buffer_[i] != rhs.buffer_[i]) return false;
+    }
+    return true;
+  }
+
+  friend bool operator!=(const buffered_engine &lhs, const buffered_engine &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  void refill()
+  {
+    _::generate(e_, buffer_, buffer_ + BufferSize);
+    index_ = 0;
+  }
+
+  alignas(64) result_type buffer_[BufferSize];
+  std::size_t index_ = BufferSize;
+  Engine e_;
+};
+
+template <class Engine, std::size_t BufferSize>
+constexpr std::size_t buffered_engine<Engine, BufferSize>::buffer_size;
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_buffered_engine_hpp
@@ -0,0 +1,302 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_bulk_hpp
+#define abz_random_bulk_hpp
+
+/// @file abz/random/bulk.hpp
+/// Vectorized bulk generation.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/simd.hpp"
+#include "abz/random/xoshiro.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class xoshiro256starstar_x8
+/// @brief Eight interleaved xoshiro256** engines.
+///
+/// Satisfies the UniformRandomBitGenerator concept. Output \f$k\f$ is the \f$(k / 8)\f$-th output
+/// of lane \f$(k \bmod 8)\f$. Each lane is separated from the previous one by a
+/// xoshiro256starstar::jump(), so lanes never overlap.
+///
+/// generate() runs the lanes with the widest vector instructions available on the running CPU
+/// (SSE2, AVX2 or AVX-512). The output does not depend on the instruction set, nor on the way the
+/// calls to generate() and operator()() are interleaved.
+///
+/// This is the engine used by @ref abz::random::fill for contiguous ranges of arithmetic types.
+class xoshiro256starstar_x8 {
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = std::uint64_t; ///< The integer type generated.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr std::size_t lanes = _::simd_lanes; ///< The number of interleaved engines.
+
+  /// @}
+
+  /// @name Construction and seeding
+  /// @{
+
+  xoshiro256starstar_x8() : xoshiro256starstar_x8(xoshiro256starstar{}) {}
+
+  /// Constructs the lanes from <tt>xoshiro256starstar{value}</tt>.
+  explicit xoshiro256starstar_x8(const result_type value)
+    : xoshiro256starstar_x8(xoshiro256starstar{value})
+  {
+  }
+
+  /// Constructs the lanes from <tt>xoshiro256starstar{seq}</tt>.
+  template <class Sseq,
+            class = typename std::enable_if<!std::is_convertible<Sseq, result_type>::value
+                                            && !std::is_same<Sseq, xoshiro256starstar_x8>::value
+                                            && !std::is_same<Sseq, xoshiro256starstar>::value>::type>
+  explicit xoshiro256starstar_x8(Sseq &seq)
+    : xoshiro256starstar_x8(xoshiro256starstar{seq})
+  {
+  }
+
+  /// Constructs the lanes from @p e: lane 0 is @p e, lane \f$l\f$ is lane \f$l - 1\f$ jumped.
+  explicit xoshiro256starstar_x8(xoshiro256starstar e) { seed(e); }
+
+  /// Reinitializes the lanes from <tt>xoshiro256starstar{value}</tt>.
+  void seed(const result_type value = xoshiro256starstar::default_seed)
+  {
+    seed(xoshiro256starstar{value});
+  }
+
+  /// Reinitializes the lanes from @p e.
+  void seed(xoshiro256starstar e)
+  {
+    for (std::size_t l = 0; l < lanes; ++l) {
+      for (std::size_t i = 0; i < 4; ++i) s_[i][l] = e.state()[i];
+      e.jump();
+    }
+    index_ = lanes;
+  }
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  /// Returns the next output.
+  result_type operator()() noexcept
+  {
+    if (index_ == lanes) {
+      _::xoshiro_x8_scalar(s_, buffer_, 1);
+      index_ = 0;
+    }
+    return buffer_[index_++];
+  }
+
+  /// Fills \f$[first, last)\f$ with the next outputs.
+  void generate(result_type *first, result_type *const last) noexcept
+  {
+    for (; index_ != lanes && first != last; ++first) *first = buffer_[index_++];
+    const std::size_t blocks = static_cast<std::size_t>(last - first) / lanes;
+    if (blocks != 0) {
+      _::xoshiro_x8(_::simd_isa_in_use(), s_, first, blocks);
+      first += blocks * lanes;
+    }
+    for (; first != last; ++first) *first = (*this)();
+  }
+
+  /// Advances the engine by @p z outputs.
+  void discard(unsigned long long z) noexcept
+  {
+    for (; z != 0; --z) (*this)();
+  }
+
+  /// @}
+
+  friend bool operator==(const xoshiro256starstar_x8 &lhs, const xoshiro256starstar_x8 &rhs)
+  {
+    return std::equal(&lhs.s_[0][0], &lhs.s_[0][0] + 4 * lanes, &rhs.s_[0][0])
+           && lhs.index_ == rhs.index_
+           && std::equal(lhs.buffer_ + lhs.index_, lhs.buffer_ + lanes, rhs.buffer_ + rhs.index_);
+  }
+
+  friend bool operator!=(const xoshiro256starstar_x8 &lhs, const xoshiro256starstar_x8 &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  alignas(64) _::simd_state s_;
+  alignas(64) result_type buffer_[lanes];
+  std::size_t index_ = lanes;
+};
+
+} // namespace random
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Types that the bulk path can generate with the same distribution as @ref abz::rand with default
+/// parameters.
+template <class T>
+struct is_bulk_generable
+  : std::integral_constant<bool,
+                           std::is_same<T, float>::value || std::is_same<T, double>::value
+                             || (std::is_integral<T>::value && sizeof(T) <= 8)> {
+};
+
+template <class Iterator,
+          class T,
+          bool = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+struct is_vector_iterator : std::false_type {
+};
+
+template <class Iterator, class T>
+struct is_vector_iterator<Iterator, T, true>
+  : std::is_same<Iterator, typename std::vector<T>::iterator> {
+};
+
+/// Iterators known to refer to contiguous storage.
+template <class Iterator, class T = typename std::iterator_traits<Iterator>::value_type>
+struct is_contiguous_iterator
+  : std::integral_constant<bool,
+                           std::is_pointer<Iterator>::value
+                             || is_vector_iterator<Iterator, T>::value> {
+};
+
+/// The iterator can be filled by the bulk path.
+template <class Iterator, class T = typename std::iterator_traits<Iterator>::value_type>
+struct is_bulk_fillable
+  : std::integral_constant<bool, is_contiguous_iterator<Iterator>::value
+                                   && is_bulk_generable<T>::value
+                                   && !std::is_const<typename std::remove_reference<
+                                        typename std::iterator_traits<Iterator>::reference>::type>::value> {
+};
+
+/// Converts a 64-bit word into values of T. Returns the number of values written.
+///
+/// Floating point values are converted as by @ref abz::rand, on \f$[0, 1]\f$: the mantissa of
+/// \f$x \in [1, 2]\f$ is the rounded top bits of the word, and the value is \f$x - 1\f$.
+inline std::size_t from_bits(const std::uint64_t w, double *out) noexcept
+{
+  *out = canonical(w, canonical_params<double>{11, 1, 1, 1.});
+  return 1;
+}
+
+inline std::size_t from_bits(const std::uint64_t w, float *out) noexcept
+{
+  out[0] = canonical(static_cast<std::uint32_t>(w), canonical_params<float>{8, 1, 1, 1.f});
+  out[1] = canonical(static_cast<std::uint32_t>(w >> 32), canonical_params<float>{8, 1, 1, 1.f});
+  return 2;
+}
+
+inline std::size_t from_bits(const std::uint64_t w, bool *out) noexcept
+{
+  for (unsigned i = 0; i < 64; ++i) out[i] = ((w >> i) & 1u) != 0;
+  return 64;
+}
+
+/// Number of values of T built from a 64-bit word.
+template <class T>
+struct values_per_word
+  : std::integral_constant<std::size_t,
+                           std::is_same<T, bool>::value     ? 64
+                           : std::is_same<T, float>::value  ? 2
+                           : std::is_same<T, double>::value ? 1
+                                                            : sizeof(std::uint64_t) / sizeof(T)> {
+};
+
+/// Mask of the bits of a word that make valid values of Integral: abz::rand<Integral>() draws from
+/// \f$[0, MAX(Integral)]\f$, so the sign bits are cleared.
+template <class Integral>
+constexpr std::uint64_t value_bits_mask() noexcept
+{
+  using U = typename std::make_unsigned<Integral>::type;
+  return ~std::uint64_t{0} / std::numeric_limits<U>::max()
+         * static_cast<std::uint64_t>(std::numeric_limits<Integral>::max());
+}
+
+/// Fills @p first with @p count values drawn with the default parameters of @ref abz::rand.
+///
+/// Floating point values are drawn from \f$[0, 1]\f$ with the full mantissa precision, integral
+/// values from \f$[0, MAX(T)]\f$, booleans take a bit each.
+template <class T, class Engine>
+void bulk_generate(Engine &g, T *first, std::size_t count, std::false_type)
+{
+  constexpr std::size_t per_word = values_per_word<T>::value;
+  constexpr std::size_t chunk = 512;
+  alignas(64) std::uint64_t words[chunk];
+  alignas(64) T values[per_word];
+  while (count >= per_word) {
+    const std::size_t n = std::min(chunk, count / per_word);
+    g.generate(words, words + n);
+    for (std::size_t i = 0; i < n; ++i) first += from_bits(words[i], first);
+    count -= n * per_word;
+  }
+  if (count != 0) {
+    from_bits(g(), values);
+    std::copy(values, values + count, first);
+  }
+}
+
+/// Integral values are the bytes of the words, so every bit drawn is used.
+template <class Integral, class Engine>
+void bulk_generate(Engine &g, Integral *first, std::size_t count, std::true_type)
+{
+  constexpr std::uint64_t mask = value_bits_mask<Integral>();
+  constexpr std::size_t chunk = 512;
+  alignas(64) std::uint64_t words[chunk];
+  while (count != 0) {
+    const std::size_t n = std::min(chunk, (count * sizeof(Integral) + 7) / 8);
+    const std::size_t m = std::min(count, n * values_per_word<Integral>::value);
+    g.generate(words, words + n);
+    if (mask != ~std::uint64_t{0}) {
+      for (std::size_t i = 0; i < n; ++i) words[i] &= mask;
+    }
+    std::memcpy(first, words, m * sizeof(Integral));
+    first += m;
+    count -= m;
+  }
+}
+
+template <class T, class Engine>
+void bulk_generate(Engine &g, T *first, std::size_t count)
+{
+  bulk_generate(g, first, count,
+                std::integral_constant<bool, std::is_integral<T>::value
+                                               && !std::is_same<T, bool>::value>{});
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_bulk_hpp
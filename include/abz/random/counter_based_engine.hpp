@@ -0,0 +1,282 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_counter_based_engine_hpp
+#define abz_random_counter_based_engine_hpp
+
+/// @file abz/random/counter_based_engine.hpp
+/// Counter-based pseudorandom number engines.
+///
+/// A counter-based engine generates its output by applying a keyed bijection to an incrementing
+/// counter. Its whole state is the pair \f$(key, counter)\f$, which makes it possible to jump to any
+/// position of the stream in constant time, and to derive independent streams by changing the key.
+///
+/// @reference J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw. Parallel random numbers: as easy
+/// as 1, 2, 3. SC'11.
+
+#include "abz/detail/macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class counter_based_engine
+/// @brief A random number engine built on top of a keyed bijection.
+///
+/// Satisfies the RandomNumberEngine concept. Each application of the bijection produces
+/// <tt>Bijection::counter_size</tt> outputs, which are returned in order before the counter is
+/// incremented.
+///
+/// The key is made of <tt>Bijection::key_size</tt> words. The first word holds the seed, the last
+/// one the stream identifier (see split()).
+///
+/// @code
+/// // Gives each worker its own slice of a single global stream.
+/// abz::random::philox4x32 g{seed};
+/// g.seek(worker_index * slice_size);
+///
+/// // Gives each worker its own independent stream.
+/// auto local = abz::random::philox4x32{seed}.split(worker_index);
+/// @endcode
+///
+/// @tparam Bijection The keyed bijection type (e.g. @ref philox or @ref threefry).
+template <class Bijection>
+class counter_based_engine {
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = typename Bijection::result_type;   ///< The integer type generated.
+  using counter_type = typename Bijection::counter_type; ///< The counter of the bijection.
+  using key_type = typename Bijection::key_type;         ///< The key of the bijection.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr std::size_t word_size = std::numeric_limits<result_type>::digits;
+  static constexpr std::size_t counter_size = std::tuple_size<counter_type>::value;
+  static constexpr std::size_t key_size = std::tuple_size<key_type>::value;
+  static constexpr result_type default_seed = 20111115u;
+
+  /// @}
+
+  /// @name Construction and seeding
+  /// @{
+
+  counter_based_engine() : counter_based_engine(default_seed) {}
+
+  /// Constructs the engine with key \f$\{value, 0, \ldots\}\f$ and a null counter.
+  explicit counter_based_engine(const result_type value) { seed(value); }
+
+  /// Constructs the engine with key values generated from a seed sequence.
+  template <class Sseq,
+            class = typename std::enable_if<!std::is_convertible<Sseq, result_type>::value
+                                            && !std::is_same<Sseq, counter_based_engine>::value
+                                            && !std::is_same<Sseq, key_type>::value>::type>
+  explicit counter_based_engine(Sseq &seq)
+  {
+    seed(seq);
+  }
+
+  /// Constructs the engine with a given key and counter.
+  explicit counter_based_engine(const key_type &key, const counter_type &counter = counter_type{})
+    : key_(key)
+    , counter_(counter)
+  {
+  }
+
+  /// Reinitializes the engine with key \f$\{value, 0, \ldots\}\f$ and a null counter.
+  void seed(const result_type value = default_seed)
+  {
+    key_.fill(0);
+    key_[0] = value;
+    reset(counter_type{});
+  }
+
+  /// Reinitializes the engine with key values generated from a seed sequence.
+  template <class Sseq>
+  typename std::enable_if<!std::is_convertible<Sseq, result_type>::value>::type seed(Sseq &seq)
+  {
+    constexpr std::size_t k = (word_size + 31) / 32;
+    std::array<std::uint_least32_t, key_size * k> a;
+    seq.generate(a.begin(), a.end());
+    for (std::size_t i = 0; i < key_size; ++i) {
+      result_type v = 0;
+      for (std::size_t j = k; j-- > 0;) {
+        v = static_cast<result_type>((k > 1 ? (v << (32 % word_size)) : v) | a[i * k + j]);
+      }
+      key_[i] = v;
+    }
+    reset(counter_type{});
+  }
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  /// Advances the engine's state and returns the generated value.
+  result_type operator()()
+  {
+    if (index_ == 0) buffer_ = Bijection::apply(counter_, key_);
+    const result_type r = buffer_[index_];
+    if (++index_ == counter_size) {
+      index_ = 0;
+      increment(counter_, 1);
+    }
+    return r;
+  }
+
+  /// Advances the engine's state by @p z notches in constant time.
+  void discard(const unsigned long long z)
+  {
+    const unsigned long long n = index_ + z % counter_size;
+    increment(counter_, z / counter_size + n / counter_size);
+    set_index(static_cast<std::size_t>(n % counter_size));
+  }
+
+  /// Moves the engine to the absolute position @p z of the stream defined by its key.
+  ///
+  /// This is the position the engine would reach from a null counter after @p z calls.
+  void seek(const unsigned long long z)
+  {
+    counter_.fill(0);
+    increment(counter_, z / counter_size);
+    set_index(static_cast<std::size_t>(z % counter_size));
+  }
+
+  /// Returns an engine generating an independent stream identified by @p stream.
+  ///
+  /// The returned engine shares the first key words of this engine, has its last key word replaced
+  /// by @p stream, and starts at the beginning of its stream.
+  counter_based_engine split(const result_type stream) const
+  {
+    key_type key = key_;
+    key[key_size - 1] = stream;
+    return counter_based_engine{key};
+  }
+
+  /// @}
+
+  /// @name State
+  /// @{
+
+  /// Returns the key of the engine.
+  const key_type &key() const noexcept { return key_; }
+
+  /// Returns the counter of the next block of outputs to generate.
+  const counter_type &counter() const noexcept { return counter_; }
+
+  /// Sets the key of the engine. The counter is left unchanged.
+  void set_key(const key_type &key)
+  {
+    key_ = key;
+    set_index(index_);
+  }
+
+  /// Sets the counter of the engine. The next output is the first one of this counter's block.
+  void set_counter(const counter_type &counter) { reset(counter); }
+
+  /// @}
+
+  friend bool operator==(const counter_based_engine &lhs, const counter_based_engine &rhs)
+  {
+    return lhs.key_ == rhs.key_ && lhs.counter_ == rhs.counter_ && lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const counter_based_engine &lhs, const counter_based_engine &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const counter_based_engine &e)
+  {
+    const auto space = os.widen(' ');
+    for (const auto k : e.key_) os << k << space;
+    for (const auto c : e.counter_) os << c << space;
+    return os << e.index_;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       counter_based_engine &e)
+  {
+    key_type key;
+    counter_type counter;
+    std::size_t index = 0;
+    for (auto &k : key) is >> k;
+    for (auto &c : counter) is >> c;
+    is >> index;
+    if (is && index < counter_size) {
+      e.key_ = key;
+      e.counter_ = counter;
+      e.set_index(index);
+    }
+    return is;
+  }
+
+private:
+  // Adds z to a multi-word little-endian counter.
+  static void increment(counter_type &counter, unsigned long long z) noexcept
+  {
+    for (std::size_t i = 0; i < counter_size && z != 0; ++i) {
+      const result_type lo = static_cast<result_type>(z);
+      counter[i] = static_cast<result_type>(counter[i] + lo);
+      const unsigned long long carry = counter[i] < lo ? 1 : 0;
+      z = (word_size < std::numeric_limits<unsigned long long>::digits ? (z >> (word_size % 64)) : 0)
+          + carry;
+    }
+  }
+
+  void reset(const counter_type &counter)
+  {
+    counter_ = counter;
+    index_ = 0;
+  }
+
+  void set_index(const std::size_t index)
+  {
+    index_ = index;
+    if (index_ != 0) buffer_ = Bijection::apply(counter_, key_);
+  }
+
+  key_type key_{};
+  counter_type counter_{};
+  counter_type buffer_{};
+  std::size_t index_ = 0;
+};
+
+template <class Bijection>
+constexpr typename counter_based_engine<Bijection>::result_type
+  counter_based_engine<Bijection>::default_seed;
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_counter_based_engine_hpp
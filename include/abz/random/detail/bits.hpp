@@ -0,0 +1,156 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_detail_bits_hpp
+#define abz_random_detail_bits_hpp
+
+/// @cond ABZ_INTERNAL
+
+/// @file abz/random/detail/bits.hpp
+/// @brief Bit manipulation helpers shared by the random engines.
+
+#include "abz/compiler.hpp"
+#include "abz/detail/macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace _ {
+
+/// Rotates @p x left by @p r bits (0 < r < digits).
+template <class UIntType>
+inline constexpr UIntType rotl(const UIntType x, const unsigned r) noexcept
+{
+  return static_cast<UIntType>((x << r) | (x >> (std::numeric_limits<UIntType>::digits - r)));
+}
+
+/// Computes the full product of @p a and @p b, returning the high half and storing the low half
+/// in @p lo.
+inline std::uint32_t mulhilo(const std::uint32_t a, const std::uint32_t b, std::uint32_t &lo) noexcept
+{
+  const std::uint64_t p = std::uint64_t{a} * std::uint64_t{b};
+  lo = static_cast<std::uint32_t>(p);
+  return static_cast<std::uint32_t>(p >> 32);
+}
+
+/// @overload
+inline std::uint64_t mulhilo(const std::uint64_t a, const std::uint64_t b, std::uint64_t &lo) noexcept
+{
+#if defined(__SIZEOF_INT128__) && (defined(ABZ_COMPILER_GCC) || defined(ABZ_COMPILER_CLANG))
+  __extension__ using uint128_t = unsigned __int128;
+  const uint128_t p = uint128_t{a} * uint128_t{b};
+  lo = static_cast<std::uint64_t>(p);
+  return static_cast<std::uint64_t>(p >> 64);
+#else
+  const std::uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+  const std::uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+  const std::uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+  const std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+  lo = (mid << 32) | (ll & 0xFFFFFFFFu);
+  return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/// SplitMix64 output function. A bijective mixing function of 64-bit integers.
+inline std::uint64_t splitmix64_mix(std::uint64_t z) noexcept
+{
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+  return z ^ (z >> 31);
+}
+
+/// Advances a SplitMix64 state and returns the next output.
+///
+/// Used to expand a single seed value into a larger engine state.
+inline std::uint64_t splitmix64_next(std::uint64_t &x) noexcept
+{
+  return splitmix64_mix(x += 0x9E3779B97F4A7C15u);
+}
+
+/// Returns the seed of the substream @p index of the stream seeded with @p seed.
+///
+/// This is the output number @p index of a SplitMix64 generator seeded with @p seed, so distinct
+/// substreams get well mixed and distinct seeds.
+inline std::uint64_t substream_seed(const std::uint64_t seed, const std::uint64_t index) noexcept
+{
+  return splitmix64_mix(seed + (index + 1) * 0x9E3779B97F4A7C15u);
+}
+
+/// Reverses the order of the bits of @p x.
+inline std::uint32_t reverse_bits(std::uint32_t x) noexcept
+{
+  x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+  x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+  x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+  x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+  return (x >> 16) | (x << 16);
+}
+
+/// Returns the index of the lowest set bit of @p x, which must not be null.
+inline unsigned lowest_bit(std::uint64_t x) noexcept
+{
+#if defined(ABZ_COMPILER_GCC) || defined(ABZ_COMPILER_CLANG)
+  return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+  unsigned n = 0;
+  for (; (x & 1u) == 0; x >>= 1) ++n;
+  return n;
+#endif
+}
+
+/// The Laine-Karras permutation with Burley's constants: each bit is flipped according to a hash of
+/// the bits below it. Applied to the reversed bits of a coordinate, it is a nested uniform (Owen)
+/// scrambling.
+inline std::uint32_t laine_karras_permutation(std::uint32_t x, const std::uint32_t seed) noexcept
+{
+  x += seed;
+  x ^= x * 0x6C50B47Cu;
+  x ^= x * 0xB82F1E52u;
+  x ^= x * 0xC7AFE638u;
+  x ^= x * 0x8D22F6E6u;
+  return x;
+}
+
+/// 64-bit FNV-1a hash of a null-terminated string.
+inline std::uint64_t fnv1a(const char *s) noexcept
+{
+  std::uint64_t h = 0xCBF29CE484222325u;
+  for (; *s != '\0'; ++s) h = (h ^ static_cast<unsigned char>(*s)) * 0x100000001B3u;
+  return h;
+}
+
+/// Generates @p N 64-bit words from a seed sequence.
+template <std::size_t N, class Sseq>
+std::array<std::uint64_t, N> generate_words(Sseq &seq)
+{
+  std::array<std::uint_least32_t, 2 * N> a;
+  seq.generate(a.begin(), a.end());
+  std::array<std::uint64_t, N> words;
+  for (std::size_t i = 0; i < N; ++i) {
+    words[i] = (std::uint64_t{a[2 * i + 1] & 0xFFFFFFFFu} << 32) | (a[2 * i] & 0xFFFFFFFFu);
+  }
+  return words;
+}
+
+} // namespace _
+
+ABZ_NAMESPACE_END
+
+/// @endcond ABZ_INTERNAL
+
+#endif // abz_random_detail_bits_hpp
@@ -0,0 +1,104 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_detail_discrete_hpp
+#define abz_random_detail_discrete_hpp
+
+/// @cond ABZ_INTERNAL
+
+/// @file abz/random/detail/discrete.hpp
+/// @brief Helpers of the samplers of discrete distributions.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/uniform_real_distribution.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace _ {
+
+/// The error of Stirling's approximation of \f$\log k!\f$:
+/// \f$\log k! - [(k + 1/2) \log (k + 1) - (k + 1) + \log \sqrt{2\pi}]\f$.
+///
+/// Tabulated up to 9, and computed with the first terms of its asymptotic series beyond.
+inline double stirling_correction(const double k) noexcept
+{
+  static constexpr double table[10] = {
+    0.081061466795327261, 0.041340695955409297, 0.027677925684998338, 0.020790672103765093,
+    0.016644691189821193, 0.013876128823070748, 0.011896709945891770, 0.010411265261972096,
+    0.0092554621827127329, 0.0083305634333628708};
+  if (k < 10) return table[static_cast<std::size_t>(k)];
+  const double r = 1. / (k + 1), r2 = r * r;
+  return (1. / 12 - (1. / 360 - 1. / 1260 * r2) * r2) * r;
+}
+
+/// Returns \f$\log k!\f$, without the global state of <tt>std::lgamma</tt>.
+inline double log_factorial(const double k) noexcept
+{
+  constexpr double log_sqrt_2pi = 0.91893853320467274;
+  return (k + .5) * std::log(k + 1) - (k + 1) + log_sqrt_2pi + stirling_correction(k);
+}
+
+/// An engine that hands out the words of @p g drawn in blocks, to feed the rejection samplers
+/// with the bulk generation of the engine. The unused words of the last block are dropped.
+template <class Engine>
+class word_buffer {
+public:
+  using result_type = std::uint64_t;
+
+  explicit word_buffer(Engine &g) : g_(g) {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()()
+  {
+    if (index_ == size) {
+      random_words(g_, words_, size);
+      index_ = 0;
+    }
+    return words_[index_++];
+  }
+
+private:
+  static constexpr std::size_t size = 256;
+
+  Engine &g_;
+  alignas(64) std::uint64_t words_[size];
+  std::size_t index_ = size;
+};
+
+/// Fills \f$[first, last)\f$ with values of @p sample, drawing from a word_buffer of @p g.
+template <class ForwardIterator, class Engine, class Sampler>
+inline void generate_buffered(ForwardIterator first,
+                              ForwardIterator last,
+                              Engine &g,
+                              const Sampler &sample)
+{
+  if (first == last) return;
+  word_buffer<Engine> words{g};
+  for (; first != last; ++first) *first = sample(words);
+}
+
+} // namespace _
+
+ABZ_NAMESPACE_END
+
+/// @endcond ABZ_INTERNAL
+
+#endif // abz_random_detail_discrete_hpp
@@ -0,0 +1,97 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_detail_parallel_hpp
+#define abz_random_detail_parallel_hpp
+
+/// @cond ABZ_INTERNAL
+
+/// @file abz/random/detail/parallel.hpp
+/// @brief Minimal fork-join helper for the parallel algorithms.
+
+#include "abz/detail/macros.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace _ {
+
+/// Returns the number of threads to use for @p tasks tasks when @p requested threads were asked
+/// for (0 meaning one per hardware thread).
+inline unsigned parallel_threads(unsigned requested, const std::size_t tasks) noexcept
+{
+  if (requested == 0) requested = std::max(1u, std::thread::hardware_concurrency());
+  return static_cast<unsigned>(std::min<std::size_t>(requested, std::max<std::size_t>(tasks, 1)));
+}
+
+/// Calls <tt>f(i)</tt> for each task \f$i \in [0, tasks)\f$ on @p threads threads (the calling
+/// thread included).
+///
+/// With @p contiguous, thread \f$t\f$ runs a fixed contiguous block of tasks, otherwise tasks are
+/// handed out dynamically. The first exception thrown by @p f is rethrown once all the threads are
+/// joined.
+template <class Function>
+void parallel_for(const std::size_t tasks,
+                  const unsigned threads,
+                  const bool contiguous,
+                  const Function &f)
+{
+  std::atomic<std::size_t> next{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  const auto worker = [&](const unsigned t) {
+    try {
+      if (contiguous) {
+        const std::size_t begin = tasks * t / threads, end = tasks * (t + 1) / threads;
+        for (std::size_t i = begin; i < end; ++i) f(i);
+      }
+      else {
+        for (std::size_t i = next++; i < tasks; i = next++) f(i);
+      }
+    }
+    catch (...) {
+      std::lock_guard<std::mutex> lock{error_mutex};
+      if (!error) error = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  unsigned spawned = 1;
+  try {
+    for (; spawned < threads; ++spawned) pool.emplace_back(worker, spawned);
+  }
+  catch (const std::system_error &) {
+    // Out of threads: the calling thread takes over the blocks of the missing workers.
+  }
+  worker(0);
+  for (unsigned t = spawned; contiguous && t < threads; ++t) worker(t);
+  for (auto &thread : pool) thread.join();
+  if (error) std::rethrow_exception(error);
+}
+
+} // namespace _
+
+ABZ_NAMESPACE_END
+
+/// @endcond ABZ_INTERNAL
+
+#endif // abz_random_detail_parallel_hpp
@@ -0,0 +1,778 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_detail_simd_hpp
+#define abz_random_detail_simd_hpp
+
+/// @cond ABZ_INTERNAL
+
+/// @file abz/random/detail/simd.hpp
+/// @brief Vectorized generation kernels and runtime instruction set selection.
+///
+/// The kernels advance 8 interleaved xoshiro256** lanes whose state is stored as a structure of
+/// arrays. All of them produce exactly the same output, only the instruction set differs. The
+/// x86 kernels are compiled with function-level target attributes, so the library does not
+/// require any -m flag and the best kernel is picked at runtime.
+///
+/// The canonical kernels convert random words into floating point values of the unit interval by
+/// writing their bits into the mantissa of a value of \f$[1, 2]\f$. They only use exact
+/// operations, so every instruction set gives the same values as the scalar conversion.
+///
+/// The Sobol kernels write points of a Sobol sequence, optionally Owen-scrambled, converting their
+/// 32-bit coordinates exactly.
+///
+/// The triangular kernels multiply blocks of vectors by a lower triangular matrix packed by
+/// columns, e.g. to correlate normal values with a Cholesky factor. They perform the same
+/// operations in the same order on every instruction set.
+///
+/// Define @c ABZ_RANDOM_NO_SIMD to only compile the portable kernel.
+
+#include "abz/compiler.hpp"
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(ABZ_RANDOM_NO_SIMD) && (defined(ABZ_COMPILER_GCC) || defined(ABZ_COMPILER_CLANG))  \
+  && (defined(__x86_64__) || defined(__i386__))
+#define ABZ_RANDOM_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+ABZ_NAMESPACE_BEGIN
+
+namespace _ {
+
+/// Number of interleaved lanes of the bulk kernels.
+constexpr std::size_t simd_lanes = 8;
+
+/// State of the interleaved lanes: <tt>s[i][l]</tt> is the i-th state word of lane l.
+using simd_state = std::uint64_t[4][simd_lanes];
+
+/// Instruction sets of the bulk kernels.
+enum class simd_isa { scalar, sse2, avx2, avx512 };
+
+/// Returns the best instruction set supported by the running CPU.
+inline simd_isa detect_simd_isa() noexcept
+{
+#if defined(ABZ_RANDOM_X86_SIMD)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return simd_isa::avx512;
+  if (__builtin_cpu_supports("avx2")) return simd_isa::avx2;
+  if (__builtin_cpu_supports("sse2")) return simd_isa::sse2;
+#endif
+  return simd_isa::scalar;
+}
+
+/// Returns the instruction set used by the bulk kernels (detected once per process).
+inline simd_isa simd_isa_in_use() noexcept
+{
+  static const simd_isa isa = detect_simd_isa();
+  return isa;
+}
+
+/// Portable kernel. Writes @p blocks times @ref simd_lanes outputs to @p out.
+inline void xoshiro_x8_scalar(simd_state &s, std::uint64_t *out, std::size_t blocks) noexcept
+{
+  for (; blocks != 0; --blocks, out += simd_lanes) {
+    for (std::size_t l = 0; l < simd_lanes; ++l) {
+      out[l] = rotl(s[1][l] * 5, 7) * 9;
+      const std::uint64_t t = s[1][l] << 17;
+      s[2][l] ^= s[0][l];
+      s[3][l] ^= s[1][l];
+      s[1][l] ^= s[2][l];
+      s[0][l] ^= s[3][l];
+      s[2][l] ^= t;
+      s[3][l] = rotl(s[3][l], 45);
+    }
+  }
+}
+
+/// Conversion of random words into values of the unit interval.
+///
+/// A word \f$w\f$ becomes \f$x - offset\f$, where \f$x \in [1, 2]\f$ has the mantissa
+/// \f$((w \gg shift) + add) \gg round\f$.
+template <class Real>
+struct canonical_params {
+  unsigned shift;
+  unsigned add;
+  unsigned round;
+  Real offset;
+};
+
+inline double canonical(const std::uint64_t w, const canonical_params<double> &p) noexcept
+{
+  const std::uint64_t bits = 0x3FF0000000000000u + (((w >> p.shift) + p.add) >> p.round);
+  double x;
+  std::memcpy(&x, &bits, sizeof(x));
+  return x - p.offset;
+}
+
+inline float canonical(const std::uint32_t w, const canonical_params<float> &p) noexcept
+{
+  const std::uint32_t bits = 0x3F800000u + (((w >> p.shift) + p.add) >> p.round);
+  float x;
+  std::memcpy(&x, &bits, sizeof(x));
+  return x - p.offset;
+}
+
+/// Portable kernel. Writes @p n doubles to @p out.
+inline void canonical_scalar(const std::uint64_t *w,
+                             double *out,
+                             const std::size_t n,
+                             const canonical_params<double> &p) noexcept
+{
+  for (std::size_t i = 0; i < n; ++i) out[i] = canonical(w[i], p);
+}
+
+/// Portable kernel. Writes \f$2n\f$ floats to @p out, the low half of each word first.
+inline void canonical_scalar(const std::uint64_t *w,
+                             float *out,
+                             const std::size_t n,
+                             const canonical_params<float> &p) noexcept
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    out[2 * i] = canonical(static_cast<std::uint32_t>(w[i]), p);
+    out[2 * i + 1] = canonical(static_cast<std::uint32_t>(w[i] >> 32), p);
+  }
+}
+
+
+/// Converts a 32-bit fraction to a double of \f$[0, 1)\f$, through a signed conversion, which the
+/// vector instruction sets have.
+inline double fraction32(const std::uint32_t x) noexcept
+{
+  return static_cast<double>(static_cast<std::int32_t>(x ^ 0x80000000u)) * (1. / 4294967296.) + .5;
+}
+
+/// State of a Sobol sequence for the Sobol kernels.
+///
+/// The direction numbers are bit-major: <tt>directions[bit * dimensions + d]</tt>. When @c seeds is
+/// not null, the sequence is scrambled and the direction numbers and the point @c x have their bits
+/// reversed.
+struct sobol_state {
+  std::uint32_t *x;
+  const std::uint32_t *directions;
+  const std::uint32_t *seeds;
+  std::size_t dimensions;
+  std::uint64_t index;
+};
+
+/// Writes the coordinates \f$[d, dimensions)\f$ of the current point to @p out.
+inline void sobol_coordinates_scalar(const sobol_state &s, std::size_t d, double *out) noexcept
+{
+  if (s.seeds == nullptr) {
+    for (; d < s.dimensions; ++d) out[d] = fraction32(s.x[d]);
+  } else {
+    for (; d < s.dimensions; ++d) {
+      out[d] = fraction32(reverse_bits(laine_karras_permutation(s.x[d], s.seeds[d])));
+    }
+  }
+}
+
+/// Moves the coordinates \f$[d, dimensions)\f$ to the next point, whose index is @c s.index.
+inline void sobol_step_scalar(const sobol_state &s, std::size_t d) noexcept
+{
+  const std::uint32_t *v = s.directions + lowest_bit(s.index) * s.dimensions;
+  for (; d < s.dimensions; ++d) s.x[d] ^= v[d];
+}
+
+/// Portable kernel. Writes @p points points to @p out, one after another.
+inline void sobol_scalar(sobol_state &s, double *out, std::size_t points) noexcept
+{
+  for (; points != 0; --points, out += s.dimensions) {
+    sobol_coordinates_scalar(s, 0, out);
+    ++s.index;
+    sobol_step_scalar(s, 0);
+  }
+}
+
+/// Offset of column @p j in a lower triangular matrix of order @p n packed by columns.
+inline std::size_t packed_column(const std::size_t j, const std::size_t n) noexcept
+{
+  return j * (2 * n - j + 1) / 2;
+}
+
+/// Number of columns the triangular kernels apply to a whole block of vectors before moving to
+/// the next ones, so that they stay in the L1 cache.
+inline std::size_t triangular_panel(const std::size_t n) noexcept
+{
+  return n < 4096 ? 4096 / n : 1;
+}
+
+/// Applies column @p j of the triangular kernels to the vector @p v: \f$v_j\f$ becomes
+/// \f$mean_j + L_{jj} v_j\f$ and \f$L_{ij} v_j\f$ is added to the \f$v_i\f$ below.
+template <class Real>
+inline void triangular_column(const Real *l,
+                              const Real *mean,
+                              const std::size_t n,
+                              const std::size_t j,
+                              Real *v) noexcept
+{
+  const Real *c = l + packed_column(j, n) - j;
+  const Real z = v[j];
+  v[j] = mean[j] + c[j] * z;
+  for (std::size_t i = j + 1; i < n; ++i) v[i] += c[i] * z;
+}
+
+/// Applies the columns \f$[j, j + 4)\f$ of the triangular kernels to the rows \f$[j, j + 4)\f$
+/// of @p v. Their original values are stored to @p z and the columns to @p c, for the kernels to
+/// update the rows below at once.
+template <class Real>
+inline void triangular_diagonal(const Real *l,
+                                const Real *mean,
+                                const std::size_t n,
+                                const std::size_t j,
+                                Real *v,
+                                Real *z,
+                                const Real **c) noexcept
+{
+  for (std::size_t k = 4; k-- != 0;) {
+    c[k] = l + packed_column(j + k, n) - (j + k);
+    z[k] = v[j + k];
+    v[j + k] = mean[j + k] + c[k][j + k] * z[k];
+    for (std::size_t i = j + k + 1; i < j + 4; ++i) v[i] += c[k][i] * z[k];
+  }
+}
+
+/// Portable kernel. Replaces each of the @p count vectors of order @p n stored one after another
+/// at @p x by \f$mean + L x\f$, @p l being \f$L\f$ packed by columns.
+///
+/// The columns are applied from the last one, so that a coordinate still holds its original value
+/// when its column is reached and the product needs no buffer. They are applied four at a time,
+/// each value being loaded and stored once for the four of them, in the order of the columns.
+template <class Real>
+inline void lower_triangular_scalar(const Real *l,
+                                    const Real *mean,
+                                    const std::size_t n,
+                                    Real *x,
+                                    const std::size_t count) noexcept
+{
+  const std::size_t panel = triangular_panel(n);
+  for (std::size_t end = n; end != 0;) {
+    const std::size_t begin = end > panel ? end - panel : 0;
+    Real *v = x;
+    for (std::size_t k = 0; k < count; ++k, v += n) {
+      for (std::size_t j = end; j != begin;) {
+        if (j - begin < 4) {
+          triangular_column(l, mean, n, --j, v);
+          continue;
+        }
+        j -= 4;
+        Real z[4];
+        const Real *c[4];
+        triangular_diagonal(l, mean, n, j, v, z, c);
+        for (std::size_t i = j + 4; i < n; ++i) {
+          v[i] = v[i] + c[3][i] * z[3] + c[2][i] * z[2] + c[1][i] * z[1] + c[0][i] * z[0];
+        }
+      }
+    }
+    end = begin;
+  }
+}
+
+#if defined(ABZ_RANDOM_X86_SIMD)
+
+// The multiplications by 5 and 9 are computed as x + (x << 2) and x + (x << 3) since there is no
+// 64-bit multiplication before AVX-512DQ.
+
+#if defined(__x86_64__) || defined(__SSE2__)
+#define ABZ_RANDOM_SSE2_TARGET
+#else
+#define ABZ_RANDOM_SSE2_TARGET __attribute__((target("sse2")))
+#endif
+
+ABZ_RANDOM_SSE2_TARGET
+inline void xoshiro_x8_sse2(simd_state &s, std::uint64_t *out, std::size_t blocks) noexcept
+{
+  constexpr std::size_t w = 2;
+  for (std::size_t v = 0; v < simd_lanes / w; ++v) {
+    __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[0][v * w]));
+    __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[1][v * w]));
+    __m128i s2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[2][v * w]));
+    __m128i s3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[3][v * w]));
+    for (std::size_t b = 0; b < blocks; ++b) {
+      __m128i r = _mm_add_epi64(s1, _mm_slli_epi64(s1, 2));
+      r = _mm_or_si128(_mm_slli_epi64(r, 7), _mm_srli_epi64(r, 57));
+      r = _mm_add_epi64(r, _mm_slli_epi64(r, 3));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + b * simd_lanes + v * w), r);
+      const __m128i t = _mm_slli_epi64(s1, 17);
+      s2 = _mm_xor_si128(s2, s0);
+      s3 = _mm_xor_si128(s3, s1);
+      s1 = _mm_xor_si128(s1, s2);
+      s0 = _mm_xor_si128(s0, s3);
+      s2 = _mm_xor_si128(s2, t);
+      s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[0][v * w]), s0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[1][v * w]), s1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[2][v * w]), s2);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[3][v * w]), s3);
+  }
+}
+
+ABZ_RANDOM_SSE2_TARGET
+inline void canonical_sse2(const std::uint64_t *w,
+                           double *out,
+                           std::size_t n,
+                           const canonical_params<double> &p) noexcept
+{
+  const __m128i one = _mm_set1_epi64x(0x3FF0000000000000);
+  const __m128i add = _mm_set1_epi64x(p.add);
+  const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+  const __m128i round = _mm_cvtsi32_si128(static_cast<int>(p.round));
+  const __m128d offset = _mm_set1_pd(p.offset);
+  for (; n >= 2; n -= 2, w += 2, out += 2) {
+    __m128i m = _mm_srl_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(w)), shift);
+    m = _mm_srl_epi64(_mm_add_epi64(m, add), round);
+    _mm_storeu_pd(out, _mm_sub_pd(_mm_castsi128_pd(_mm_add_epi64(m, one)), offset));
+  }
+  canonical_scalar(w, out, n, p);
+}
+
+ABZ_RANDOM_SSE2_TARGET
+inline void canonical_sse2(const std::uint64_t *w,
+                           float *out,
+                           std::size_t n,
+                           const canonical_params<float> &p) noexcept
+{
+  const __m128i one = _mm_set1_epi32(0x3F800000);
+  const __m128i add = _mm_set1_epi32(static_cast<int>(p.add));
+  const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+  const __m128i round = _mm_cvtsi32_si128(static_cast<int>(p.round));
+  const __m128 offset = _mm_set1_ps(p.offset);
+  for (; n >= 2; n -= 2, w += 2, out += 4) {
+    __m128i m = _mm_srl_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(w)), shift);
+    m = _mm_srl_epi32(_mm_add_epi32(m, add), round);
+    _mm_storeu_ps(out, _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(m, one)), offset));
+  }
+  canonical_scalar(w, out, n, p);
+}
+
+/// The scrambling needs 32-bit multiplications, so it stays scalar before AVX2.
+ABZ_RANDOM_SSE2_TARGET
+inline void sobol_sse2(sobol_state &s, double *out, std::size_t points) noexcept
+{
+  constexpr std::size_t w = 4;
+  const std::size_t n = s.dimensions - s.dimensions % w;
+  const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+  const __m128d scale = _mm_set1_pd(1. / 4294967296.), half = _mm_set1_pd(.5);
+  for (; points != 0; --points, out += s.dimensions) {
+    if (s.seeds == nullptr) {
+      for (std::size_t d = 0; d < n; d += w) {
+        const __m128i x = _mm_xor_si128(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(s.x + d)), sign);
+        _mm_storeu_pd(out + d, _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(x), scale), half));
+        _mm_storeu_pd(out + d + 2,
+                      _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(x, 8)), scale), half));
+      }
+      sobol_coordinates_scalar(s, n, out);
+    } else {
+      sobol_coordinates_scalar(s, 0, out);
+    }
+    ++s.index;
+    const std::uint32_t *v = s.directions + lowest_bit(s.index) * s.dimensions;
+    for (std::size_t d = 0; d < n; d += w) {
+      __m128i *x = reinterpret_cast<__m128i *>(s.x + d);
+      _mm_storeu_si128(x, _mm_xor_si128(_mm_loadu_si128(x),
+                                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(v + d))));
+    }
+    sobol_step_scalar(s, n);
+  }
+}
+
+ABZ_RANDOM_SSE2_TARGET
+inline void lower_triangular_sse2(const double *l,
+                                  const double *mean,
+                                  const std::size_t n,
+                                  double *x,
+                                  const std::size_t count) noexcept
+{
+  const std::size_t panel = triangular_panel(n);
+  for (std::size_t end = n; end != 0;) {
+    const std::size_t begin = end > panel ? end - panel : 0;
+    double *v = x;
+    for (std::size_t k = 0; k < count; ++k, v += n) {
+      for (std::size_t j = end; j != begin;) {
+        if (j - begin < 4) {
+          triangular_column(l, mean, n, --j, v);
+          continue;
+        }
+        j -= 4;
+        double z[4];
+        const double *c[4];
+        triangular_diagonal(l, mean, n, j, v, z, c);
+        const __m128d z0 = _mm_set1_pd(z[0]), z1 = _mm_set1_pd(z[1]);
+        const __m128d z2 = _mm_set1_pd(z[2]), z3 = _mm_set1_pd(z[3]);
+        std::size_t i = j + 4;
+        for (; i + 2 <= n; i += 2) {
+          __m128d y = _mm_mul_pd(_mm_loadu_pd(c[3] + i), z3);
+          y = _mm_add_pd(_mm_loadu_pd(v + i), y);
+          y = _mm_add_pd(y, _mm_mul_pd(_mm_loadu_pd(c[2] + i), z2));
+          y = _mm_add_pd(y, _mm_mul_pd(_mm_loadu_pd(c[1] + i), z1));
+          _mm_storeu_pd(v + i, _mm_add_pd(y, _mm_mul_pd(_mm_loadu_pd(c[0] + i), z0)));
+        }
+        for (; i < n; ++i) {
+          v[i] = v[i] + c[3][i] * z[3] + c[2][i] * z[2] + c[1][i] * z[1] + c[0][i] * z[0];
+        }
+      }
+    }
+    end = begin;
+  }
+}
+
+#undef ABZ_RANDOM_SSE2_TARGET
+
+__attribute__((target("avx2")))
+inline void xoshiro_x8_avx2(simd_state &s, std::uint64_t *out, std::size_t blocks) noexcept
+{
+  constexpr std::size_t w = 4;
+  for (std::size_t v = 0; v < simd_lanes / w; ++v) {
+    __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&s[0][v * w]));
+    __m256i s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&s[1][v * w]));
+    __m256i s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&s[2][v * w]));
+    __m256i s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&s[3][v * w]));
+    for (std::size_t b = 0; b < blocks; ++b) {
+      __m256i r = _mm256_add_epi64(s1, _mm256_slli_epi64(s1, 2));
+      r = _mm256_or_si256(_mm256_slli_epi64(r, 7), _mm256_srli_epi64(r, 57));
+      r = _mm256_add_epi64(r, _mm256_slli_epi64(r, 3));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + b * simd_lanes + v * w), r);
+      const __m256i t = _mm256_slli_epi64(s1, 17);
+      s2 = _mm256_xor_si256(s2, s0);
+      s3 = _mm256_xor_si256(s3, s1);
+      s1 = _mm256_xor_si256(s1, s2);
+      s0 = _mm256_xor_si256(s0, s3);
+      s2 = _mm256_xor_si256(s2, t);
+      s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&s[0][v * w]), s0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&s[1][v * w]), s1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&s[2][v * w]), s2);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&s[3][v * w]), s3);
+  }
+}
+
+__attribute__((target("avx2")))
+inline void canonical_avx2(const std::uint64_t *w,
+                           double *out,
+                           std::size_t n,
+                           const canonical_params<double> &p) noexcept
+{
+  const __m256i one = _mm256_set1_epi64x(0x3FF0000000000000);
+  const __m256i add = _mm256_set1_epi64x(p.add);
+  const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+  const __m128i round = _mm_cvtsi32_si128(static_cast<int>(p.round));
+  const __m256d offset = _mm256_set1_pd(p.offset);
+  for (; n >= 4; n -= 4, w += 4, out += 4) {
+    __m256i m = _mm256_srl_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(w)), shift);
+    m = _mm256_srl_epi64(_mm256_add_epi64(m, add), round);
+    _mm256_storeu_pd(out, _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(m, one)), offset));
+  }
+  canonical_scalar(w, out, n, p);
+}
+
+__attribute__((target("avx2")))
+inline void canonical_avx2(const std::uint64_t *w,
+                           float *out,
+                           std::size_t n,
+                           const canonical_params<float> &p) noexcept
+{
+  const __m256i one = _mm256_set1_epi32(0x3F800000);
+  const __m256i add = _mm256_set1_epi32(static_cast<int>(p.add));
+  const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+  const __m128i round = _mm_cvtsi32_si128(static_cast<int>(p.round));
+  const __m256 offset = _mm256_set1_ps(p.offset);
+  for (; n >= 4; n -= 4, w += 4, out += 8) {
+    __m256i m = _mm256_srl_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(w)), shift);
+    m = _mm256_srl_epi32(_mm256_add_epi32(m, add), round);
+    _mm256_storeu_ps(out, _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(m, one)), offset));
+  }
+  canonical_scalar(w, out, n, p);
+}
+
+/// Reverses the bits of the 32-bit lanes of @p x.
+__attribute__((target("avx2")))
+inline __m256i reverse_bits_avx2(const __m256i x) noexcept
+{
+  const __m256i nibbles = _mm256_setr_epi8(0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15,
+                                           0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15);
+  const __m256i bytes = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                         3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  const __m256i low = _mm256_set1_epi8(0x0F);
+  const __m256i y = _mm256_shuffle_epi8(x, bytes);
+  const __m256i lo = _mm256_shuffle_epi8(nibbles, _mm256_and_si256(y, low));
+  const __m256i hi = _mm256_shuffle_epi8(nibbles, _mm256_and_si256(_mm256_srli_epi16(y, 4), low));
+  return _mm256_or_si256(_mm256_slli_epi16(lo, 4), hi);
+}
+
+__attribute__((target("avx2")))
+inline void sobol_avx2(sobol_state &s, double *out, std::size_t points) noexcept
+{
+  constexpr std::size_t w = 8;
+  const std::size_t n = s.dimensions - s.dimensions % w;
+  const __m256i sign = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+  const __m256i k0 = _mm256_set1_epi32(0x6C50B47C), k1 = _mm256_set1_epi32(0xB82F1E52);
+  const __m256i k2 = _mm256_set1_epi32(0xC7AFE638), k3 = _mm256_set1_epi32(0x8D22F6E6);
+  const __m256d scale = _mm256_set1_pd(1. / 4294967296.), half = _mm256_set1_pd(.5);
+  for (; points != 0; --points, out += s.dimensions) {
+    for (std::size_t d = 0; d < n; d += w) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s.x + d));
+      if (s.seeds != nullptr) {
+        const __m256i seed = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s.seeds + d));
+        x = _mm256_add_epi32(x, seed);
+        x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, k0));
+        x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, k1));
+        x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, k2));
+        x = _mm256_xor_si256(x, _mm256_mullo_epi32(x, k3));
+        x = reverse_bits_avx2(x);
+      }
+      x = _mm256_xor_si256(x, sign);
+      const __m256d lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(x));
+      const __m256d hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1));
+      _mm256_storeu_pd(out + d, _mm256_add_pd(_mm256_mul_pd(lo, scale), half));
+      _mm256_storeu_pd(out + d + 4, _mm256_add_pd(_mm256_mul_pd(hi, scale), half));
+    }
+    sobol_coordinates_scalar(s, n, out);
+    ++s.index;
+    const std::uint32_t *v = s.directions + lowest_bit(s.index) * s.dimensions;
+    for (std::size_t d = 0; d < n; d += w) {
+      __m256i *x = reinterpret_cast<__m256i *>(s.x + d);
+      _mm256_storeu_si256(
+        x, _mm256_xor_si256(_mm256_loadu_si256(x),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(v + d))));
+    }
+    sobol_step_scalar(s, n);
+  }
+}
+
+__attribute__((target("avx2")))
+inline void lower_triangular_avx2(const double *l,
+                                  const double *mean,
+                                  const std::size_t n,
+                                  double *x,
+                                  const std::size_t count) noexcept
+{
+  const std::size_t panel = triangular_panel(n);
+  for (std::size_t end = n; end != 0;) {
+    const std::size_t begin = end > panel ? end - panel : 0;
+    double *v = x;
+    for (std::size_t k = 0; k < count; ++k, v += n) {
+      for (std::size_t j = end; j != begin;) {
+        if (j - begin < 4) {
+          triangular_column(l, mean, n, --j, v);
+          continue;
+        }
+        j -= 4;
+        double z[4];
+        const double *c[4];
+        triangular_diagonal(l, mean, n, j, v, z, c);
+        const __m256d z0 = _mm256_set1_pd(z[0]), z1 = _mm256_set1_pd(z[1]);
+        const __m256d z2 = _mm256_set1_pd(z[2]), z3 = _mm256_set1_pd(z[3]);
+        std::size_t i = j + 4;
+        for (; i + 4 <= n; i += 4) {
+          __m256d y = _mm256_mul_pd(_mm256_loadu_pd(c[3] + i), z3);
+          y = _mm256_add_pd(_mm256_loadu_pd(v + i), y);
+          y = _mm256_add_pd(y, _mm256_mul_pd(_mm256_loadu_pd(c[2] + i), z2));
+          y = _mm256_add_pd(y, _mm256_mul_pd(_mm256_loadu_pd(c[1] + i), z1));
+          _mm256_storeu_pd(v + i, _mm256_add_pd(y, _mm256_mul_pd(_mm256_loadu_pd(c[0] + i), z0)));
+        }
+        for (; i < n; ++i) {
+          v[i] = v[i] + c[3][i] * z[3] + c[2][i] * z[2] + c[1][i] * z[1] + c[0][i] * z[0];
+        }
+      }
+    }
+    end = begin;
+  }
+}
+
+// GCC 12 reports a false -Wmaybe-uninitialized inside its AVX-512 intrinsics (GCC #105593).
+#if defined(ABZ_COMPILER_GCC)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline void xoshiro_x8_avx512(simd_state &s, std::uint64_t *out, std::size_t blocks) noexcept
+{
+  __m512i s0 = _mm512_loadu_si512(&s[0][0]);
+  __m512i s1 = _mm512_loadu_si512(&s[1][0]);
+  __m512i s2 = _mm512_loadu_si512(&s[2][0]);
+  __m512i s3 = _mm512_loadu_si512(&s[3][0]);
+  for (std::size_t b = 0; b < blocks; ++b) {
+    __m512i r = _mm512_add_epi64(s1, _mm512_slli_epi64(s1, 2));
+    r = _mm512_rol_epi64(r, 7);
+    r = _mm512_add_epi64(r, _mm512_slli_epi64(r, 3));
+    _mm512_storeu_si512(out + b * simd_lanes, r);
+    const __m512i t = _mm512_slli_epi64(s1, 17);
+    s2 = _mm512_xor_si512(s2, s0);
+    s3 = _mm512_xor_si512(s3, s1);
+    s1 = _mm512_xor_si512(s1, s2);
+    s0 = _mm512_xor_si512(s0, s3);
+    s2 = _mm512_xor_si512(s2, t);
+    s3 = _mm512_rol_epi64(s3, 45);
+  }
+  _mm512_storeu_si512(&s[0][0], s0);
+  _mm512_storeu_si512(&s[1][0], s1);
+  _mm512_storeu_si512(&s[2][0], s2);
+  _mm512_storeu_si512(&s[3][0], s3);
+}
+
+__attribute__((target("avx512f")))
+inline void canonical_avx512(const std::uint64_t *w,
+                             double *out,
+                             std::size_t n,
+                             const canonical_params<double> &p) noexcept
+{
+  const __m512i one = _mm512_set1_epi64(0x3FF0000000000000);
+  const __m512i add = _mm512_set1_epi64(p.add);
+  const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+  const __m128i round = _mm_cvtsi32_si128(static_cast<int>(p.round));
+  const __m512d offset = _mm512_set1_pd(p.offset);
+  for (; n >= 8; n -= 8, w += 8, out += 8) {
+    __m512i m = _mm512_srl_epi64(_mm512_loadu_si512(w), shift);
+    m = _mm512_srl_epi64(_mm512_add_epi64(m, add), round);
+    _mm512_storeu_pd(out, _mm512_sub_pd(_mm512_castsi512_pd(_mm512_add_epi64(m, one)), offset));
+  }
+  canonical_scalar(w, out, n, p);
+}
+
+__attribute__((target("avx512f")))
+inline void canonical_avx512(const std::uint64_t *w,
+                             float *out,
+                             std::size_t n,
+                             const canonical_params<float> &p) noexcept
+{
+  const __m512i one = _mm512_set1_epi32(0x3F800000);
+  const __m512i add = _mm512_set1_epi32(static_cast<int>(p.add));
+  const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+  const __m128i round = _mm_cvtsi32_si128(static_cast<int>(p.round));
+  const __m512 offset = _mm512_set1_ps(p.offset);
+  for (; n >= 8; n -= 8, w += 8, out += 16) {
+    __m512i m = _mm512_srl_epi32(_mm512_loadu_si512(w), shift);
+    m = _mm512_srl_epi32(_mm512_add_epi32(m, add), round);
+    _mm512_storeu_ps(out, _mm512_sub_ps(_mm512_castsi512_ps(_mm512_add_epi32(m, one)), offset));
+  }
+  canonical_scalar(w, out, n, p);
+}
+
+#if defined(ABZ_COMPILER_GCC)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // ABZ_RANDOM_X86_SIMD
+
+/// Runs the kernel matching @p isa.
+inline void xoshiro_x8(const simd_isa isa,
+                       simd_state &s,
+                       std::uint64_t *out,
+                       const std::size_t blocks) noexcept
+{
+  switch (isa) {
+#if defined(ABZ_RANDOM_X86_SIMD)
+    case simd_isa::avx512:
+      return xoshiro_x8_avx512(s, out, blocks);
+    case simd_isa::avx2:
+      return xoshiro_x8_avx2(s, out, blocks);
+    case simd_isa::sse2:
+      return xoshiro_x8_sse2(s, out, blocks);
+#endif
+    default:
+      return xoshiro_x8_scalar(s, out, blocks);
+  }
+}
+
+/// Runs the canonical kernel matching @p isa on @p n words.
+template <class Real>
+inline void canonical(const simd_isa isa,
+                      const std::uint64_t *w,
+                      Real *out,
+                      const std::size_t n,
+                      const canonical_params<Real> &p) noexcept
+{
+  switch (isa) {
+#if defined(ABZ_RANDOM_X86_SIMD)
+    case simd_isa::avx512:
+      return canonical_avx512(w, out, n, p);
+    case simd_isa::avx2:
+      return canonical_avx2(w, out, n, p);
+    case simd_isa::sse2:
+      return canonical_sse2(w, out, n, p);
+#endif
+    default:
+      return canonical_scalar(w, out, n, p);
+  }
+}
+
+/// Runs the Sobol kernel matching @p isa.
+inline void sobol(const simd_isa isa,
+                  sobol_state &s,
+                  double *out,
+                  const std::size_t points) noexcept
+{
+  switch (isa) {
+#if defined(ABZ_RANDOM_X86_SIMD)
+    case simd_isa::avx512:
+    case simd_isa::avx2:
+      return sobol_avx2(s, out, points);
+    case simd_isa::sse2:
+      return sobol_sse2(s, out, points);
+#endif
+    default:
+      return sobol_scalar(s, out, points);
+  }
+}
+
+/// Runs the triangular kernel matching @p isa.
+inline void lower_triangular(const simd_isa isa,
+                             const double *l,
+                             const double *mean,
+                             const std::size_t n,
+                             double *x,
+                             const std::size_t count) noexcept
+{
+  switch (isa) {
+#if defined(ABZ_RANDOM_X86_SIMD)
+    case simd_isa::avx512:
+    case simd_isa::avx2:
+      return lower_triangular_avx2(l, mean, n, x, count);
+    case simd_isa::sse2:
+      return lower_triangular_sse2(l, mean, n, x, count);
+#endif
+    default:
+      return lower_triangular_scalar(l, mean, n, x, count);
+  }
+}
+
+/// @overload
+///
+/// Single and extended precision only have the portable kernel.
+template <class Real>
+inline void lower_triangular(simd_isa,
+                             const Real *l,
+                             const Real *mean,
+                             const std::size_t n,
+                             Real *x,
+                             const std::size_t count) noexcept
+{
+  lower_triangular_scalar(l, mean, n, x, count);
+}
+
+} // namespace _
+
+ABZ_NAMESPACE_END
+
+/// @endcond ABZ_INTERNAL
+
+#endif // abz_random_detail_simd_hpp
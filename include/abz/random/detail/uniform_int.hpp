@@ -0,0 +1,269 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_detail_uniform_int_hpp
+#define abz_random_detail_uniform_int_hpp
+
+/// @cond ABZ_INTERNAL
+
+/// @file abz/random/detail/uniform_int.hpp
+/// @brief Random bits extraction and bounded integers sampling.
+///
+/// @reference D. Lemire. Fast random integer generation in an interval. ACM Transactions on
+/// Modeling and Computer Simulation, 2019.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace _ {
+
+/// Number of uniformly random bits per output of Engine, or 0 when the range of the engine is not
+/// \f$[0, 2^{32})\f$ or \f$[0, 2^{64})\f$.
+template <class Engine>
+struct engine_bits
+  : std::integral_constant<unsigned,
+                           Engine::min() != 0 ? 0
+                           : Engine::max() == 0xFFFFFFFFu ? 32
+                           : Engine::max() == 0xFFFFFFFFFFFFFFFFu ? 64
+                                                                  : 0> {
+};
+
+/// Number of values in the range of Engine, 0 standing for \f$2^{64}\f$.
+template <class Engine>
+struct engine_range
+  : std::integral_constant<std::uint64_t,
+                           static_cast<std::uint64_t>(Engine::max())
+                             - static_cast<std::uint64_t>(Engine::min()) + 1u> {
+};
+
+/// True for the engines whose words are not whole 32 or 64-bit words, but whose outputs fit in 32
+/// bits once shifted to 0 (e.g. <tt>std::minstd_rand</tt>, on \f$[1, 2^{31} - 1)\f$): bounded
+/// integers are then drawn from their native range.
+template <class Engine>
+struct narrow_engine
+  : std::integral_constant<bool,
+                           engine_bits<Engine>::value == 0 && engine_range<Engine>::value != 0
+                             && engine_range<Engine>::value <= 0x100000000u> {
+};
+
+/// Returns the output of @p g shifted to start at 0.
+template <class Engine>
+inline std::uint64_t native_word(Engine &g)
+{
+  return static_cast<std::uint64_t>(g()) - static_cast<std::uint64_t>(Engine::min());
+}
+
+template <class UIntType, class Engine>
+inline UIntType random_bits(Engine &g, std::integral_constant<unsigned, 64>)
+{
+  return static_cast<UIntType>(static_cast<std::uint64_t>(g())
+                               >> (64 - std::numeric_limits<UIntType>::digits));
+}
+
+template <class UIntType, class Engine>
+inline UIntType random_bits(Engine &g, std::integral_constant<unsigned, 32>)
+{
+  if (std::numeric_limits<UIntType>::digits <= 32) return static_cast<UIntType>(g());
+  const std::uint64_t hi = static_cast<std::uint32_t>(g());
+  return static_cast<UIntType>((hi << 32) | static_cast<std::uint32_t>(g()));
+}
+
+template <class UIntType, class Engine>
+inline UIntType random_bits(Engine &g, std::integral_constant<unsigned, 0>)
+{
+  return std::uniform_int_distribution<UIntType>{}(g);
+}
+
+/// Returns a uniformly random 32 or 64-bit word drawn from @p g.
+///
+/// Takes one or two outputs of engines with a \f$[0, 2^{32})\f$ or \f$[0, 2^{64})\f$ range, and
+/// falls back to <tt>std::uniform_int_distribution</tt> for the others.
+template <class UIntType, class Engine>
+inline UIntType random_bits(Engine &g)
+{
+  static_assert(std::is_same<UIntType, std::uint32_t>::value
+                  || std::is_same<UIntType, std::uint64_t>::value,
+                "Only 32 and 64-bit words are supported");
+  return random_bits<UIntType>(g, std::integral_constant<unsigned, engine_bits<Engine>::value>{});
+}
+
+/// Unsigned counterpart of an integral type (bool included).
+template <class Integral>
+struct make_unsigned : std::make_unsigned<Integral> {
+};
+
+template <>
+struct make_unsigned<bool> {
+  using type = unsigned;
+};
+
+/// Word type used to sample an integral type.
+template <class Integral>
+using sampling_word_t =
+  typename std::conditional<(sizeof(Integral) <= 4), std::uint32_t, std::uint64_t>::type;
+
+/// Draws a value uniformly distributed on \f$[0, range)\f$, \f$0 < range \leq R\f$, from single
+/// outputs of a narrow engine of \f$R\f$ values.
+///
+/// Lemire's method holds for any range of the engine: \f$\lfloor x \cdot range / R \rfloor\f$ is
+/// uniform once the products whose remainder is below \f$R \bmod range\f$ are rejected. \f$R\f$ is
+/// a constant, so that the division is a multiplication.
+template <class UIntType, class Engine>
+inline UIntType native_bounded(Engine &g, const UIntType range)
+{
+  constexpr std::uint64_t r = engine_range<Engine>::value;
+  const std::uint64_t n = range;
+  std::uint64_t m = native_word(g) * n;
+  if (m % r < n) {
+    const std::uint64_t threshold = r % n;
+    while (m % r < threshold) m = native_word(g) * n;
+  }
+  return static_cast<UIntType>(m / r);
+}
+
+/// Uniform sampler of \f$[0, range)\f$ using Lemire's multiply-shift method.
+///
+/// The rejection threshold \f$2^W \bmod range\f$ is computed once at construction, so drawing a
+/// value costs one multiplication and no division. A null @p range stands for \f$2^W\f$.
+template <class UIntType>
+class bounded_sampler {
+public:
+  explicit bounded_sampler(const UIntType range) noexcept
+    : range_(range)
+    , threshold_(range == 0 ? 0 : static_cast<UIntType>(static_cast<UIntType>(-range) % range))
+  {
+  }
+
+  template <class Engine>
+  UIntType operator()(Engine &g) const
+  {
+    return sample(g, narrow_engine<Engine>{});
+  }
+
+private:
+  template <class Engine>
+  UIntType sample(Engine &g, std::true_type) const
+  {
+    if (range_ != 0 && range_ <= engine_range<Engine>::value) return native_bounded(g, range_);
+    return sample(g, std::false_type{});
+  }
+
+  template <class Engine>
+  UIntType sample(Engine &g, std::false_type) const
+  {
+    UIntType x = random_bits<UIntType>(g);
+    if (range_ == 0) return x;
+    UIntType lo;
+    UIntType hi = mulhilo(x, range_, lo);
+    while (lo < threshold_) {
+      x = random_bits<UIntType>(g);
+      hi = mulhilo(x, range_, lo);
+    }
+    return hi;
+  }
+
+  UIntType range_;
+  UIntType threshold_;
+};
+
+/// Draws a value uniformly distributed on \f$[0, range)\f$ (\f$[0, 2^W)\f$ if @p range is null).
+///
+/// Lemire's nearly divisionless method: the modulo is only computed in the rare cases where the
+/// first draw falls in the biased zone.
+template <class UIntType, class Engine>
+inline UIntType bounded(Engine &g, const UIntType range, std::false_type)
+{
+  UIntType x = random_bits<UIntType>(g);
+  if (range == 0) return x;
+  UIntType lo;
+  UIntType hi = mulhilo(x, range, lo);
+  if (lo < range) {
+    const UIntType threshold = static_cast<UIntType>(static_cast<UIntType>(-range) % range);
+    while (lo < threshold) {
+      x = random_bits<UIntType>(g);
+      hi = mulhilo(x, range, lo);
+    }
+  }
+  return hi;
+}
+
+template <class UIntType, class Engine>
+inline UIntType bounded(Engine &g, const UIntType range, std::true_type)
+{
+  if (range != 0 && range <= engine_range<Engine>::value) return native_bounded(g, range);
+  return bounded(g, range, std::false_type{});
+}
+
+template <class UIntType, class Engine>
+inline UIntType bounded(Engine &g, const UIntType range)
+{
+  return bounded(g, range, narrow_engine<Engine>{});
+}
+
+/// Uniform sampler of an integral type on \f$[a, b]\f$.
+template <class Integral>
+class uniform_int_sampler {
+  using unsigned_type = typename make_unsigned<Integral>::type;
+  using word_type = sampling_word_t<Integral>;
+
+public:
+  uniform_int_sampler(const Integral a, const Integral b) noexcept
+    : a_(a)
+    , sampler_(range(a, b))
+  {
+  }
+
+  template <class Engine>
+  Integral operator()(Engine &g) const
+  {
+    return static_cast<Integral>(static_cast<unsigned_type>(a_) + sampler_(g));
+  }
+
+  /// Returns the number of values of \f$[a, b]\f$ (0 meaning \f$2^W\f$).
+  static word_type range(const Integral a, const Integral b) noexcept
+  {
+    const unsigned_type difference
+      = static_cast<unsigned_type>(static_cast<unsigned_type>(b) - static_cast<unsigned_type>(a));
+    return static_cast<word_type>(static_cast<word_type>(difference) + 1u);
+  }
+
+private:
+  Integral a_;
+  bounded_sampler<word_type> sampler_;
+};
+
+/// Draws an integral value uniformly distributed on \f$[a, b]\f$.
+template <class Integral, class Engine>
+inline Integral uniform_int(Engine &g, const Integral a, const Integral b)
+{
+  using unsigned_type = typename make_unsigned<Integral>::type;
+  using word_type = sampling_word_t<Integral>;
+  return static_cast<Integral>(
+    static_cast<unsigned_type>(a)
+    + bounded<word_type>(g, uniform_int_sampler<Integral>::range(a, b)));
+}
+
+} // namespace _
+
+ABZ_NAMESPACE_END
+
+/// @endcond ABZ_INTERNAL
+
+#endif // abz_random_detail_uniform_int_hpp
@@ -0,0 +1,272 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_detail_ziggurat_hpp
+#define abz_random_detail_ziggurat_hpp
+
+/// @cond ABZ_INTERNAL
+
+/// @file abz/random/detail/ziggurat.hpp
+/// @brief Ziggurat samplers of the standard normal and exponential distributions.
+///
+/// @reference G. Marsaglia, W. W. Tsang. The ziggurat method for generating random variables.
+/// Journal of Statistical Software, 2000.
+/// @reference J. A. Doornik. An improved ziggurat method to generate normal random samples.
+/// University of Oxford, 2005.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/bulk.hpp"
+#include "abz/random/detail/simd.hpp"
+#include "abz/random/detail/uniform_int.hpp"
+#include "abz/random/uniform_real_distribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace _ {
+
+/// Layers of equal area covering a decreasing density.
+///
+/// Layer \f$i\f$ spans \f$[0, x_i)\f$; the base layer 0 also holds the tail beyond \f$r =
+/// x_1\f$ and \f$ratio_i = x_{i + 1} / x_i\f$ is the part of layer \f$i\f$ that lies entirely under
+/// the density.
+template <std::size_t Layers>
+struct ziggurat_table {
+  template <class Density>
+  ziggurat_table(const double r, const double v, const Density &density)
+  {
+    double f = density.f(r);
+    x[0] = v / f;
+    x[1] = r;
+    for (std::size_t i = 2; i < Layers; ++i) {
+      x[i] = density.inverse(v / x[i - 1] + f);
+      f = density.f(x[i]);
+    }
+    x[Layers] = 0;
+    for (std::size_t i = 0; i < Layers; ++i) ratio[i] = x[i + 1] / x[i];
+  }
+
+  double x[Layers + 1];
+  double ratio[Layers];
+};
+
+/// Returns a value of \f$[0, 1)\f$ built from the high bits of @p w.
+inline double unit_closed_open(const std::uint64_t w) noexcept
+{
+  return canonical(w, canonical_traits<double, random::interval::closed_open>::params());
+}
+
+/// Returns a value of \f$(0, 1)\f$ drawn from @p g.
+template <class Engine>
+inline double unit_open(Engine &g)
+{
+  return canonical(random_bits<std::uint64_t>(g),
+                   canonical_traits<double, random::interval::open>::params());
+}
+
+/// Standard normal distribution: 128 layers, the sign is taken from the uniform.
+struct normal_ziggurat {
+  static constexpr std::size_t layers = 128;
+
+  double f(const double x) const { return std::exp(-0.5 * x * x); }
+  double inverse(const double y) const { return std::sqrt(-2. * std::log(y)); }
+
+  static const ziggurat_table<layers> &table()
+  {
+    static const ziggurat_table<layers> t{3.442619855899, 9.91256303526217e-3, normal_ziggurat{}};
+    return t;
+  }
+
+  /// Uniform of \f$[-1, 1)\f$ taken from the bits of @p w that are not used by the layer index.
+  static double unit(const std::uint64_t w) noexcept { return 2. * unit_closed_open(w) - 1.; }
+
+  static bool inside(const double u, const double ratio) noexcept { return std::fabs(u) < ratio; }
+
+  /// Ends the sampling of a draw \f$(i, u)\f$ that did not fall in the inner part of its layer.
+  template <class Engine>
+  static double slow(Engine &g, std::size_t i, double u)
+  {
+    const ziggurat_table<layers> &t = table();
+    for (;;) {
+      if (i == 0) return tail(g, t.x[1], u < 0);
+      const double x = u * t.x[i];
+      const double f0 = std::exp(-0.5 * (t.x[i] * t.x[i] - x * x));
+      const double f1 = std::exp(-0.5 * (t.x[i + 1] * t.x[i + 1] - x * x));
+      if (f1 + unit_open(g) * (f0 - f1) < 1.) return x;
+      const std::uint64_t w = random_bits<std::uint64_t>(g);
+      i = static_cast<std::size_t>(w & (layers - 1));
+      u = unit(w);
+      if (inside(u, t.ratio[i])) return u * t.x[i];
+    }
+  }
+
+  /// Marsaglia's sampling of the tail beyond @p r.
+  template <class Engine>
+  static double tail(Engine &g, const double r, const bool negative)
+  {
+    double x, y;
+    do {
+      x = std::log(unit_open(g)) / r;
+      y = std::log(unit_open(g));
+    } while (-2. * y < x * x);
+    return negative ? x - r : r - x;
+  }
+};
+
+/// Standard exponential distribution: 256 layers.
+struct exponential_ziggurat {
+  static constexpr std::size_t layers = 256;
+
+  double f(const double x) const { return std::exp(-x); }
+  double inverse(const double y) const { return -std::log(y); }
+
+  static const ziggurat_table<layers> &table()
+  {
+    static const ziggurat_table<layers> t{7.69711747013104972, 3.949659822581572e-3,
+                                          exponential_ziggurat{}};
+    return t;
+  }
+
+  /// Uniform of \f$[0, 1)\f$ taken from the bits of @p w that are not used by the layer index.
+  static double unit(const std::uint64_t w) noexcept { return unit_closed_open(w); }
+
+  static bool inside(const double u, const double ratio) noexcept { return u < ratio; }
+
+  template <class Engine>
+  static double slow(Engine &g, std::size_t i, double u)
+  {
+    const ziggurat_table<layers> &t = table();
+    for (;;) {
+      // The distribution is memoryless: the tail is a shifted exponential.
+      if (i == 0) return t.x[1] - std::log(unit_open(g));
+      const double x = u * t.x[i];
+      const double f0 = std::exp(x - t.x[i]);
+      const double f1 = std::exp(x - t.x[i + 1]);
+      if (f1 + unit_open(g) * (f0 - f1) < 1.) return x;
+      const std::uint64_t w = random_bits<std::uint64_t>(g);
+      i = static_cast<std::size_t>(w & (layers - 1));
+      u = unit(w);
+      if (inside(u, t.ratio[i])) return u * t.x[i];
+    }
+  }
+};
+
+/// Draws a value of the standard distribution of Ziggurat.
+template <class Ziggurat, class Engine>
+inline double ziggurat(Engine &g)
+{
+  const ziggurat_table<Ziggurat::layers> &t = Ziggurat::table();
+  const std::uint64_t w = random_bits<std::uint64_t>(g);
+  const std::size_t i = static_cast<std::size_t>(w & (Ziggurat::layers - 1));
+  const double u = Ziggurat::unit(w);
+  if (Ziggurat::inside(u, t.ratio[i])) return u * t.x[i];
+  return Ziggurat::slow(g, i, u);
+}
+
+/// Writes @p n values <tt>transform(z)</tt> to @p out, \f$z\f$ following the standard distribution
+/// of Ziggurat.
+///
+/// The words are drawn in bulk and the whole chunk goes through the inner part of the layers
+/// without branches. The few draws that fall outside are then finished one by one.
+template <class Ziggurat, class Engine, class Real, class Transform>
+void ziggurat_n(Engine &g, Real *out, std::size_t n, const Transform &transform)
+{
+  constexpr std::size_t chunk = 256;
+  const ziggurat_table<Ziggurat::layers> &t = Ziggurat::table();
+  alignas(64) std::uint64_t words[chunk];
+  std::size_t rejected[chunk];
+  while (n != 0) {
+    const std::size_t m = std::min(chunk, n);
+    random_words(g, words, m);
+    std::size_t r = 0;
+    for (std::size_t k = 0; k < m; ++k) {
+      const std::size_t i = static_cast<std::size_t>(words[k] & (Ziggurat::layers - 1));
+      const double u = Ziggurat::unit(words[k]);
+      out[k] = static_cast<Real>(transform(u * t.x[i]));
+      rejected[r] = k;
+      r += Ziggurat::inside(u, t.ratio[i]) ? 0 : 1;
+    }
+    for (std::size_t j = 0; j < r; ++j) {
+      const std::size_t k = rejected[j];
+      const std::size_t i = static_cast<std::size_t>(words[k] & (Ziggurat::layers - 1));
+      out[k] = static_cast<Real>(transform(Ziggurat::slow(g, i, Ziggurat::unit(words[k]))));
+    }
+    out += m;
+    n -= m;
+  }
+}
+
+template <class Ziggurat, class Engine, class ContiguousIterator, class Transform>
+inline ContiguousIterator ziggurat_generate_n(Engine &g,
+                                              ContiguousIterator first,
+                                              const std::size_t n,
+                                              const Transform &transform,
+                                              std::true_type)
+{
+  if (n != 0) ziggurat_n<Ziggurat>(g, &*first, n, transform);
+  return first + static_cast<typename std::iterator_traits<ContiguousIterator>::difference_type>(n);
+}
+
+template <class Ziggurat, class Engine, class OutputIterator, class Transform>
+inline OutputIterator ziggurat_generate_n(Engine &g,
+                                          OutputIterator first,
+                                          std::size_t n,
+                                          const Transform &transform,
+                                          std::false_type)
+{
+  constexpr std::size_t chunk = 256;
+  decltype(transform(0.)) values[chunk];
+  while (n != 0) {
+    const std::size_t m = std::min(chunk, n);
+    ziggurat_n<Ziggurat>(g, values, m, transform);
+    first = std::copy(values, values + m, first);
+    n -= m;
+  }
+  return first;
+}
+
+/// Writes @p n values <tt>transform(z)</tt> to @p first, straight into contiguous ranges.
+template <class Ziggurat, class Engine, class OutputIterator, class Transform>
+inline OutputIterator ziggurat_generate_n(Engine &g,
+                                          OutputIterator first,
+                                          const std::size_t n,
+                                          const Transform &transform)
+{
+  return ziggurat_generate_n<Ziggurat>(
+    g, first, n, transform,
+    std::integral_constant<bool, is_contiguous_iterator<OutputIterator>::value>{});
+}
+
+/// Fills \f$[first, last)\f$ with values <tt>transform(z)</tt>.
+template <class Ziggurat, class Engine, class ForwardIterator, class Transform>
+inline void ziggurat_generate(Engine &g,
+                              ForwardIterator first,
+                              ForwardIterator last,
+                              const Transform &transform)
+{
+  ziggurat_generate_n<Ziggurat>(g, first, static_cast<std::size_t>(std::distance(first, last)),
+                                transform);
+}
+
+} // namespace _
+
+ABZ_NAMESPACE_END
+
+/// @endcond ABZ_INTERNAL
+
+#endif // abz_random_detail_ziggurat_hpp
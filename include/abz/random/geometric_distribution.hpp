@@ -0,0 +1,195 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_geometric_distribution_hpp
+#define abz_random_geometric_distribution_hpp
+
+/// @file abz/random/geometric_distribution.hpp
+/// Geometric distribution sampled by inversion.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class geometric_distribution
+/// @brief Geometric distribution sampled by inversion.
+///
+/// Satisfies the RandomNumberDistribution concept and can replace
+/// <tt>std::geometric_distribution</tt>: values are the numbers of failures before the first
+/// success of Bernoulli trials of probability \f$p\f$.
+///
+/// The inverse of the distribution function is \f$\lfloor -\log U / -\log(1 - p) \rfloor\f$, where
+/// \f$-\log U\f$ is a standard exponential value. It is drawn with the Ziggurat method of @ref
+/// exponential_distribution, so that a value costs a single 64-bit word, a multiplication by the
+/// precomputed \f$-1/\log(1 - p)\f$ and a rounding, without any logarithm. generate() fills whole
+/// ranges at once with words drawn in bulk.
+///
+/// @tparam IntType An integral type.
+template <class IntType = int>
+class geometric_distribution {
+  static_assert(std::is_integral<IntType>::value, "IntType must be an integral type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = IntType; ///< The integral type generated.
+
+  /// The parameters of the distribution.
+  class param_type {
+  public:
+    using distribution_type = geometric_distribution;
+
+    explicit param_type(const double p = .5)
+      : p_(p)
+      , scale_(-1. / std::log1p(-p))
+    {
+    }
+
+    double p() const noexcept { return p_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.p_ == rhs.p_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class geometric_distribution;
+
+    double p_;
+    double scale_; // -1 / log(1 - p).
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  geometric_distribution() : geometric_distribution(.5) {}
+
+  explicit geometric_distribution(const double p) : p_(p) {}
+
+  explicit geometric_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return transform{p.scale_}(_::ziggurat<_::exponential_ziggurat>(g));
+  }
+
+  /// Fills \f$[first, last)\f$ with geometrically distributed values.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values following the distribution of parameters @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    _::ziggurat_generate<_::exponential_ziggurat>(g, first, last, transform{p.scale_});
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  double p() const noexcept { return p_.p(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return 0; }
+  result_type max() const noexcept { return std::numeric_limits<result_type>::max(); }
+
+  /// @}
+
+  friend bool operator==(const geometric_distribution &lhs, const geometric_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const geometric_distribution &lhs, const geometric_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const geometric_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+    os << d.p();
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       geometric_distribution &d)
+  {
+    double p;
+    if (is >> p) d.param(param_type{p});
+    return is;
+  }
+
+private:
+  /// Rounds a scaled exponential value down, saturating at the largest value of IntType.
+  struct transform {
+    result_type operator()(const double z) const
+    {
+      constexpr double max = static_cast<double>(std::numeric_limits<result_type>::max());
+      const double x = std::floor(scale * z);
+      return x < max ? static_cast<result_type>(x) : std::numeric_limits<result_type>::max();
+    }
+    double scale;
+  };
+
+  param_type p_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_geometric_distribution_hpp
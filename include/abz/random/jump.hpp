@@ -0,0 +1,561 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_jump_hpp
+#define abz_random_jump_hpp
+
+/// @file abz/random/jump.hpp
+/// Jump-ahead of the engines of the standard library.
+///
+/// The standard engines only offer a linear time <tt>discard(z)</tt>. These functions advance them
+/// by huge strides at once, so that a single seeded engine can be split into non-overlapping
+/// streams:
+///
+/// @code
+/// std::mt19937_64 e{seed};
+/// for (unsigned k = 0; k < worker_index; ++k) abz::random::jump(e); // 2^64 notches each
+/// @endcode
+///
+/// @reference H. Haramoto, M. Matsumoto, T. Nishimura, F. Panneton, P. L'Ecuyer. Efficient jump
+/// ahead for F2-linear random number generators. INFORMS Journal on Computing, 2008.
+/// @reference F. B. Brown. Random number generation with arbitrary strides. Transactions of the
+/// American Nuclear Society, 1994.
+
+#include "abz/compiler.hpp"
+#include "abz/detail/macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <random>
+#include <sstream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Computes \f$a \cdot b \bmod m\f$ for a non-null @p m.
+inline std::uint64_t mulmod(const std::uint64_t a,
+                            const std::uint64_t b,
+                            const std::uint64_t m) noexcept
+{
+#if defined(__SIZEOF_INT128__) && (defined(ABZ_COMPILER_GCC) || defined(ABZ_COMPILER_CLANG))
+  __extension__ using uint128_t = unsigned __int128;
+  return static_cast<std::uint64_t>(uint128_t{a} * uint128_t{b} % m);
+#else
+  if (a <= 0xFFFFFFFFu && b <= 0xFFFFFFFFu) return a * b % m;
+  std::uint64_t x = a % m, p = 0;
+  for (std::uint64_t y = b; y != 0; y >>= 1) {
+    if (y & 1) p = p >= m - x ? p - (m - x) : p + x;
+    x = x >= m - x ? x - (m - x) : x + x;
+  }
+  return p;
+#endif
+}
+
+/// Arithmetic modulo \f$m\f$, a null @p m standing for \f$2^W\f$, \f$W\f$ being the number of bits
+/// of UIntType.
+template <class UIntType, UIntType m>
+struct modular {
+  static std::uint64_t add(const std::uint64_t x, const std::uint64_t y) noexcept
+  {
+    return m == 0 ? static_cast<UIntType>(x + y) : x >= m - y ? x - (m - y) : x + y;
+  }
+
+  static std::uint64_t mul(const std::uint64_t x, const std::uint64_t y) noexcept
+  {
+    return m == 0 ? static_cast<UIntType>(x * y) : mulmod(x, y, m);
+  }
+};
+
+/// Inverts <tt>y = x ^ ((x >> shift) & mask)</tt>.
+template <class UIntType>
+inline UIntType unshift_right(const UIntType y, const std::size_t shift, const UIntType mask,
+                              const std::size_t w) noexcept
+{
+  UIntType x = y;
+  for (std::size_t k = shift; k < w; k += shift) x = y ^ ((x >> shift) & mask);
+  return x;
+}
+
+/// Inverts <tt>y = x ^ ((x << shift) & mask)</tt>.
+template <class UIntType>
+inline UIntType unshift_left(const UIntType y, const std::size_t shift, const UIntType mask,
+                             const std::size_t w) noexcept
+{
+  UIntType x = y;
+  for (std::size_t k = shift; k < w; k += shift) x = y ^ ((x << shift) & mask);
+  return x;
+}
+
+/// Replaces the state of @p e by its image by the jump @p polynomial.
+///
+/// The engines do not expose their state: the next \f$n\f$ outputs are untempered into the words of
+/// the state that follows them, the state is advanced by Horner's scheme (the polynomial of a
+/// stride \f$J\f$ is \f$t^{J - n}\f$ modulo the characteristic polynomial of the recurrence) and
+/// written back through the textual representation of the engine.
+template <class UIntType,
+          std::size_t w,
+          std::size_t n,
+          std::size_t m,
+          std::size_t r,
+          UIntType a,
+          std::size_t u,
+          UIntType d,
+          std::size_t s,
+          UIntType b,
+          std::size_t t,
+          UIntType c,
+          std::size_t l,
+          UIntType f,
+          std::size_t Words>
+void mersenne_twister_jump(
+  std::mersenne_twister_engine<UIntType, w, n, m, r, a, u, d, s, b, t, c, l, f> &e,
+  const std::uint64_t (&polynomial)[Words])
+{
+  static_assert(Words * 64 >= n * w - r, "The polynomial is too short");
+  // The words are handled in the narrowest type that holds them (std::mt19937 stores 32-bit words
+  // in std::uint_fast32_t).
+  using word_type = typename std::conditional<(w <= 32), std::uint32_t, std::uint64_t>::type;
+  constexpr std::size_t digits = std::numeric_limits<word_type>::digits;
+  constexpr word_type mask
+    = w == digits ? std::numeric_limits<word_type>::max()
+                  : static_cast<word_type>((word_type{1} << (w % digits)) - 1u);
+  constexpr word_type lower = static_cast<word_type>((word_type{1} << r) - 1u);
+  constexpr word_type upper = static_cast<word_type>(~lower & mask);
+
+  // The state slides along a buffer of twice its size so that its words stay contiguous: x[i] is
+  // its oldest word.
+  std::array<word_type, 2 * n> x;
+  for (std::size_t k = 0; k < n; ++k) {
+    word_type y = static_cast<word_type>(e());
+    y = unshift_right<word_type>(y, l, mask, w);
+    y = unshift_left<word_type>(y, t, static_cast<word_type>(c), w);
+    y = unshift_left<word_type>(y, s, static_cast<word_type>(b), w);
+    x[k] = unshift_right<word_type>(y, u, static_cast<word_type>(d), w);
+  }
+
+  std::array<word_type, n> jumped{};
+  std::size_t i = 0;
+  for (std::size_t k = 0; k < n * w - r; ++k) {
+    if (polynomial[k / 64] & (std::uint64_t{1} << (k % 64))) {
+      for (std::size_t j = 0; j < n; ++j) jumped[j] ^= x[i + j];
+    }
+    const word_type y = (x[i] & upper) | (x[i + 1] & lower);
+    x[i + n] = x[i + m] ^ (y >> 1) ^ ((y & 1u) ? static_cast<word_type>(a) : word_type{0});
+    if (++i == n) {
+      std::copy(x.begin() + n, x.end(), x.begin());
+      i = 0;
+    }
+  }
+
+  // The textual representation is the n words of the state, oldest first. The trailing index is
+  // the position of the next word to generate for the implementations that store it.
+  std::stringstream text;
+  text.imbue(std::locale::classic());
+  for (const word_type word : jumped) text << word << ' ';
+  text << n;
+  text >> e;
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @name Jump-ahead of the linear congruential engines
+/// @{
+
+/// Advances @p e by @p z notches in \f$O(\log z)\f$.
+///
+/// The \f$z\f$ steps of the engine make an affine map \f$x \mapsto A x + C \bmod m\f$ computed by
+/// repeated squaring.
+template <class UIntType, UIntType a, UIntType c, UIntType m>
+void discard(std::linear_congruential_engine<UIntType, a, c, m> &e, unsigned long long z)
+{
+  using mod = _::modular<UIntType, m>;
+  if (z-- == 0) return;
+  // The output of the engine is its new state.
+  const std::uint64_t x = e();
+  std::uint64_t mult = 1, plus = 0;
+  for (std::uint64_t step_mult = a, step_plus = c; z != 0; z >>= 1) {
+    if (z & 1) {
+      mult = mod::mul(mult, step_mult);
+      plus = mod::add(mod::mul(plus, step_mult), step_plus);
+    }
+    step_plus = mod::mul(mod::add(step_mult, 1), step_plus);
+    step_mult = mod::mul(step_mult, step_mult);
+  }
+  e.seed(static_cast<UIntType>(mod::add(mod::mul(mult, x), plus)));
+}
+
+/// @}
+
+/// @name Jump-ahead of the Mersenne Twister
+///
+/// The stride is applied through a precomputed jump polynomial in a few milliseconds, independently
+/// of its length.
+/// @{
+
+/// Advances @p e by \f$2^{64}\f$ notches.
+inline void jump(std::mt19937 &e)
+{
+  static constexpr std::uint64_t polynomial[] = {
+    0x54347BA281B467F8u, 0x09C5669BAFB9B29Bu, 0x444C6230AB319949u, 0x858F143410719358u,
+    0x088C675B2DD2C3A7u, 0xBEDD8649EB5E2D1Eu, 0x650F90116AEE41BCu, 0x46508B5A7D3E47DEu,
+    0xB09B1D6D868808E7u, 0x95BC76EEE76D6248u, 0x6B786887FC7E0B55u, 0xE996D74596CD69B2u,
+    0x3F306B357E99095Au, 0xB9B328702AD4FFDBu, 0xF9385E539ACFBBAAu, 0x80AC36F84405D3A6u,
+    0x91DEE4712EF09208u, 0x793ED35D49C1A304u, 0x3DB1DC1A194610C3u, 0x69EC627A28A5B6B3u,
+    0x72EA64BED36EC523u, 0x7851C6963A677D73u, 0xB6AA799956C1AA45u, 0x7B5DC6F46517974Bu,
+    0x2361C97722F29429u, 0x6BF66C6E80A6A51Cu, 0x356FE3ED14D5414Bu, 0x979314762364012Au,
+    0xA49608FCE642DD9Eu, 0xADFBDF36C9671AA5u, 0x445268ED0F94C2A1u, 0xE9971508772C37A6u,
+    0x0104D0EE907B7613u, 0x01FD5C1F9B026491u, 0x5C10B94A2C22BE94u, 0x9F66919FFE934674u,
+    0x1776C476056310A5u, 0x99A440C669C2FBF2u, 0xA25BA6597BC03DC9u, 0x5FCE92E33CFE2145u,
+    0x57FA5C57813E48F2u, 0x6B3F54F617FFD8CAu, 0xA43468EA169FDC23u, 0xBF4A3BEFDF02C233u,
+    0xD9FA1AE66C38AD02u, 0x0192BA4A3B653FFEu, 0xF38DCB3562284195u, 0x14C520D8A024206Bu,
+    0x310409B70B0266F6u, 0x9B0B1E8ABB413403u, 0xE87F53549A165576u, 0x5735A1922C0864D3u,
+    0xE8BB5B4D0DFFA009u, 0xC846ACB78FDD4044u, 0xCCDDAEB3D83A1976u, 0xFBD91EDDC41AC168u,
+    0x7AA76C337CDAA69Cu, 0x9903597FEF232C40u, 0x4661C291F5FB9C19u, 0x2D17BC94807E0582u,
+    0x67C6F5BB646F592Bu, 0xE96CDCD80F39A33Fu, 0x5BCD2044D1A19419u, 0xD2FD346BD420A99Fu,
+    0xAEDB8B62F305D907u, 0x8B45DF156D21BBD1u, 0x29DDFB5C257C5736u, 0xACF03C7123417269u,
+    0x65568214C8396E32u, 0xC34CF395766CE8AFu, 0xCA44124AC51EF239u, 0x2386240566C214F4u,
+    0xF143B1BDE38492A9u, 0xCD50EE03309B46ECu, 0x063BF6F21A2E556Au, 0xC754A512E19B8EC8u,
+    0x8A5B0F37F1580CA3u, 0xBE43C43F6CE4E60Bu, 0xC95993B1F4BC3D1Du, 0x381C49CD8FC52CA8u,
+    0x5974F97E21F1F2C1u, 0x5EA2AD293879800Bu, 0x083E8E52176D9A15u, 0xA6D10D326222C1A1u,
+    0x54C5B39E8A94CE92u, 0x8F9B75EFE36F78B7u, 0x608AD182E96869EBu, 0xD22A6D669808660Bu,
+    0xAC29FAD143AF1078u, 0x6649FC66FD0D93F5u, 0x4B5C3D9B0E1C62BFu, 0x45397E72088D8C6Cu,
+    0x967712C037453CCCu, 0x6DD5179D43F5D283u, 0xD30E36964407B477u, 0x5FB99BB6FB67B739u,
+    0x706DD5AD9A8D0F83u, 0x70445DA11E69D6F8u, 0xBF890397F115807Eu, 0x6216979CD2295E49u,
+    0x5975A6EF9A09DEE2u, 0x090CF2295E62B986u, 0xF754DB19A58056F2u, 0x75B2EBBD6A38AD59u,
+    0x953170C44D904D8Cu, 0x2DFEE4CFA5C87630u, 0x047C96FD3AE41FA0u, 0xA38BBC01381F5F30u,
+    0x812AA66D17AABC1Au, 0x71EBBA3B62F4AE3Cu, 0xB2830C402FC50587u, 0x8E5CE24700EFF4DAu,
+    0x20698AD33D277A6Cu, 0xC6C476763F1DE04Fu, 0x2B00F76A57F7D42Au, 0x569226FFD7BB9922u,
+    0x76B1734455EC3556u, 0x28500F2FE56474E2u, 0x618812E447C4BD44u, 0xE96A961FC2F3E8D5u,
+    0x82E44EAE644742B7u, 0xD609D08F5EC26F75u, 0x21A524BEDF64DC03u, 0x31814E5D6B9ACC70u,
+    0x0E3E7E830692B85Au, 0xC975D2B6850B62BDu, 0xCAF5D56E49A5397Bu, 0x166602B46EF0C5E3u,
+    0xDF2B0E55F2380FC8u, 0xF1F4F26AF1792D3Eu, 0x95761A858D2FE839u, 0xC59B41DD69AE6C12u,
+    0x9C719BBC0BA4F290u, 0x67D487492C1F504Bu, 0x6AE890078F7E5FEEu, 0xE52B461F3A634F3Du,
+    0xA23BF0E76ABD5A3Cu, 0x141828CCA53F65F1u, 0xA0BF0ADD6CB2BB14u, 0x7C45895D49E2C70Bu,
+    0x8FABCF8BD1355C25u, 0x5706F1E8674142C2u, 0x5A882624E9948733u, 0x38BB01D06FFF4102u,
+    0x4246A1A2820150A4u, 0x4537EA1B68A18A69u, 0x4AAD194E1D1B8032u, 0x6F1116E10FA4DF1Eu,
+    0x148BBD58485F1BB3u, 0x277775DA647AEA66u, 0x8679B71C16CDDA9Au, 0xC64E379074672AC1u,
+    0x969E92F11558A31Bu, 0x1040E32E1CA85EB6u, 0x75B127B140F1CFC3u, 0x88452C2451B364D9u,
+    0x871893849F632DD7u, 0xA93E0DE2D363D62Cu, 0x8826E5FDACF3A5E3u, 0xC120E4103783873Fu,
+    0xCB71F624CE733C0Bu, 0xA9694BF6A4450BF9u, 0xC0EF107A047907DDu, 0xDEB0DF605E8F318Au,
+    0x5FE34FB066702B9Eu, 0xD6687CA4765BE210u, 0x17CF6589547D4DB3u, 0xF759816CB398F22Eu,
+    0xC99D45FD1F8C124Du, 0x0D2125907C70B3FDu, 0x4609129B65B7B9E0u, 0xBE1182580D3BB823u,
+    0x2327C84BD0225E43u, 0x8CFC0CF3ECC4DE55u, 0xE956BAC87E288D6Fu, 0x77BBF70D13CA6447u,
+    0xA19F253D20B7A8B8u, 0x7FB9C1BEFBC6EB55u, 0xCFCBAC19E04A591Cu, 0x3562F0061054FD47u,
+    0x4FC96C6F7E736784u, 0x5E9002A0691EF5C2u, 0x0C93DA8DC2E8065Du, 0xEDD9878EEEA1BD2Eu,
+    0xECD64F54650ACB85u, 0xD8E255236C3FB321u, 0xDEA64A7D1000D4BFu, 0xDFD709E2C37E62BBu,
+    0x8B88973D3832EB2Du, 0x610D147CBF0B6AD1u, 0xBCF770389233C04Du, 0x6E97B8D2DE864F5Cu,
+    0x3B2CE7BE62AC620Du, 0x87AF2E60383615C8u, 0x0D62CBAE6F8E5BDFu, 0x1BF1B8D8F68ED8BEu,
+    0x92E2D5D5AAF915C7u, 0x5EF6BDF53433F590u, 0x4DB99285FCB1B074u, 0x7B7CFE0227EA20D2u,
+    0x5447959F8D3E63B5u, 0xC9C9AA8F18E5C2A6u, 0xAC1170EDC063392Du, 0x8F4EC0C9D69DD9C6u,
+    0x61CAC41CC172AA31u, 0x6FF7BE0F30BCE8A4u, 0x2ED0B43FC87FBB72u, 0xB4E2359CA2E95507u,
+    0x228375A6B51C4F23u, 0xCFE545595248AA3Cu, 0xA78FACB40EEA8803u, 0x2B009BCA83705B1Bu,
+    0xACD71C09394436EBu, 0x96BD4B7B310843ECu, 0xC7B374EBE563BCDCu, 0x46502B874E67AC0Fu,
+    0x73FE757C9F2565E8u, 0x8D2555C019775875u, 0x28EC954C415141F6u, 0xDAAA4A80418383D8u,
+    0x79FB7A3D44B75FACu, 0x10A3289DFFCC479Au, 0xAFC982DBE8CB783Eu, 0xD62A953C5CEA5C2Eu,
+    0x5FD1196EF4972C60u, 0xAA47F8D7A3094D38u, 0x62A27803136DF41Du, 0xFEC75C7BDDCF06FAu,
+    0x45801B139EA179F4u, 0xE45B02BCA272FB14u, 0xD7E755B1389F79FEu, 0x169870AAEF155B31u,
+    0x4E582C30A553BA2Eu, 0x6809B12D95E5C3C4u, 0x45A3447A6232A1A7u, 0xA9414DFDBA56A001u,
+    0x1E83163B9E52D327u, 0x151BC6BEFDD01FA6u, 0xC162B4F3176AE0C6u, 0xD7BCA3F3B2F00418u,
+    0xFB29A094FE8BE81Eu, 0xFC1C9C5CE0372EDDu, 0x9BA50DAE9220B7A3u, 0xF7801B424A9E7D91u,
+    0xD8C6244AF97925EFu, 0x4AA76759E2B10633u, 0xC573CA47D95BD642u, 0x0FC624F4574F5F42u,
+    0xF00F56D7C26612C1u, 0x91D8EFF4C9DFBE4Bu, 0x4864660091CC78EFu, 0x359D6C1640D8D728u,
+    0x0D326DB8C945B63Au, 0x0812D7A30CFDE16Au, 0x44F93B74E2BC06DEu, 0xB48C63BA65C4DC17u,
+    0x8F8EDE61AC1047B4u, 0xFA7413DC7B4BD375u, 0xEF88E05849A1F9A0u, 0xE126C971F93D547Fu,
+    0xBD3C0774ED341C13u, 0xEFF815C1E2BF2117u, 0xBBD2B74FD8351A46u, 0x535492E0570D8636u,
+    0x1ECC5CDC9F92116Au, 0xF0A3B1354D4240FBu, 0x9E5FDC9AAA01CAACu, 0xE4F9E85F6305D325u,
+    0x2F85588C917C9316u, 0xCBF3065CC0C58342u, 0x30E7ABFE266BD477u, 0x37B5960C4B18BE7Du,
+    0xC9F426CDFF7917B4u, 0x9062EBAD5474AFFEu, 0x358A90F4B66E5FDBu, 0xB59671B1EDB114E2u,
+    0x3FCA11B729308D05u, 0x0B73CBF5E323248Du, 0x3DB6D8B64D3ED127u, 0x33A78DF4E681596Eu,
+    0xD99F3BB26DF2C3D8u, 0x8E18A707E122FEF6u, 0x9940D2CA1F0D9933u, 0xB43DAC40FAD18ACCu,
+    0xA3E1B5089A49B14Cu, 0x104AFAA29019D0ECu, 0x47A8DED448B4BD25u, 0x8D82D52B85957743u,
+    0x9E56D0F3A018D2A8u, 0xD5EA1E83F3A54DD6u, 0xB0B3B4BCB0D34F3Bu, 0x694B536E04114F42u,
+    0x7D089145B28A37DAu, 0x37DF8F4A4A95D592u, 0xC56FAC0750E63A91u, 0xCA23A23AE36BFA01u,
+    0xDD2DC7DC21CB466Cu, 0x39E0D2DFEE877FD2u, 0x5561F041701CC32Cu, 0xDAD5BD47A27258AFu,
+    0x57FD4F1B49C0C7FEu, 0x1EC78AF6392350EDu, 0xB55BC491499A9920u, 0x45E4058BC2C4EAAAu,
+    0x533798F7BA96EEA6u, 0x7F7FFF08EEC760E2u, 0x18685B9677F6A968u, 0xC0CDC41699DEBF97u,
+    0x2102A75BB6EFC5F3u, 0xCCB116671ABC7FA0u, 0xAF57B23CA675FC85u, 0x00000000CD28CF2Bu};
+  _::mersenne_twister_jump(e, polynomial);
+}
+
+/// Advances @p e by \f$2^{128}\f$ notches.
+inline void long_jump(std::mt19937 &e)
+{
+  static constexpr std::uint64_t polynomial[] = {
+    0xDCBF01BD8267FEBDu, 0xF574E2A67DE65147u, 0xDECAB8334D099AFEu, 0x703B5561FD58F0D3u,
+    0x8F42EF5C803BD884u, 0xFED320DFB761B39Bu, 0x6177CF5F3E5BD61Cu, 0xCFAB8E8442E94741u,
+    0xDBED585D0EC08EA9u, 0xA0D882885DA63B1Au, 0x2848B6C4274DF404u, 0xBBC9022DAD7D1139u,
+    0x66F221082D2278B9u, 0xF752B5F1D788A870u, 0xBC2BE78B9048C620u, 0x8B7BF205176B4B8Eu,
+    0x225469BCFCC6C793u, 0x5136119BB78A1F69u, 0xE5A3DB30304F4549u, 0x7B4E7F44693BA910u,
+    0x4087121F54A9F449u, 0xE026CCF10E8D929Cu, 0xC0E83464EB772647u, 0x341F0246EDA1D677u,
+    0x9A080E71D4CFC189u, 0x9B6D8497EA9FC269u, 0xC34FD984012036D2u, 0x9D3D8AD902B8FE54u,
+    0xA5A18C103CE534F9u, 0x41861F605DBA75E1u, 0x6A938FE721730556u, 0x4C360897DC422EA5u,
+    0x70CD67A12D58BFE9u, 0x2EE521EE7F0756E1u, 0xFD93BD0A7BC24BE7u, 0xFCD7C447D74D60D0u,
+    0x6FA6D683AE9EE0D7u, 0x2703CCEE15366453u, 0x4DA81EBB6364F46Du, 0x5A22F6EBC3B0D23Bu,
+    0x0F23EF11188188F5u, 0xA5B24D8789CD6250u, 0x33E83867D6D4EFA3u, 0xA9E4B3D8045A19B8u,
+    0xECEF8E2AD2EB5E11u, 0x098E26D05B4AFF5Du, 0xD1837004611C7B64u, 0x9F66D5F027DA1C92u,
+    0x3108B3F33D1DE9E8u, 0x8EA88BD051A06DC3u, 0xE8CF8438A505D503u, 0x2645F10F5EC41560u,
+    0x3F36792B3217FB51u, 0xA39853F92D27207Bu, 0x4FE85E2AD13C5B3Cu, 0x5079EC007014FBA3u,
+    0x1C25B49E9E1FE3FBu, 0x61FB940CC3E84A5Au, 0x3AF91C9D85B999F4u, 0x193E7089FCE38FB5u,
+    0x1F7F369DD11FE794u, 0x5F54C33E338867B1u, 0x69B0EB2E158C4468u, 0x8D079D51CD2F9F1Eu,
+    0xBA3DF7CB1D520BCBu, 0x646D47DC7E45D518u, 0x8502F7AF66751DDFu, 0xABF7C031562B968Bu,
+    0x9D89088AEF568388u, 0xFAE154573F9ED951u, 0x052E65100790D855u, 0xF6757CD563C02366u,
+    0xDC67F707512852CDu, 0xFD0C68C5083BCC83u, 0x086D1441C9C33A17u, 0x0EC996C47491DC80u,
+    0x1ADDA254E42DB5C3u, 0xEE5B963A3612A932u, 0xD40F035C75C7C30Bu, 0x10F9EE9E9C80514Fu,
+    0x531344B2EA8E3822u, 0xD6169C5E3A15ADACu, 0x3C4D7C384BEAA73Fu, 0x48846B27868E17ADu,
+    0x5F31ED02AE7D858Bu, 0xD9864E963E10D6DBu, 0x168F05170ED353C0u, 0x2349181A139B89ACu,
+    0xEB3126C6F903B229u, 0xDA2CB401474949B8u, 0x4AF257FAA5A616A8u, 0xE1AA715D16E84957u,
+    0x4D965CBD6BE1A532u, 0x83A5E570D2C6735Au, 0xE878738AD378DDA2u, 0x79381E08E56FAD31u,
+    0x52260507D9505434u, 0x060E254359120977u, 0xE2F855905CF7E6A1u, 0x033C5DB235223E25u,
+    0xB4C717D020324B5Eu, 0x98132CE162DC3F59u, 0x2792D6E9DD6A058Cu, 0x881D549F01454202u,
+    0x7778212468C5FF5Bu, 0x2D7B9B668A7125A7u, 0x606C269D419E12F2u, 0xA977CAB717080B0Fu,
+    0x204B363CE6C5F6BDu, 0x8EEA36655ECF8BFFu, 0xA3A22DFC3ABEC6ABu, 0x25EB4C25FF83FDACu,
+    0xC4383392FE802AEEu, 0xE91453EBC0A2CACBu, 0xCC6B9EADAE773357u, 0xE2A01FFD710422CAu,
+    0xFF22DC91B2C1F308u, 0x52082809DB7F6366u, 0x686259D4B2C9451Bu, 0x42A4478AA9895855u,
+    0xD55D042A42C6436Cu, 0xF41007C7F4B1F648u, 0x2DC0E1EDBD912969u, 0x49BD2885F4351D5Fu,
+    0xFF3A060ADED49311u, 0x4E0C00F44619D81Fu, 0xE638D4FE65896DF8u, 0x5E0C1F65D391E122u,
+    0x0568A7CB0AA9B63Bu, 0x8A1E06D90AC57337u, 0x898C9805C7AD6615u, 0x36907890ADDEC4A3u,
+    0x7E0885C39B207FC5u, 0x05EDC0C864F8C542u, 0xD2BFC365017A2FBAu, 0xA0038FFB95EA210Au,
+    0x63C48E6C4F72609Cu, 0x1CA83C11056284E6u, 0x583A8700B723753Cu, 0x25537E4DA8A4ADD8u,
+    0xC40BBDC366F7DEBEu, 0x537004D4817BBDC5u, 0x2E77C96966933FF1u, 0x90E4F5B550A6EF1Cu,
+    0x4F694098B4ABC910u, 0x8FDF6E42B43792CDu, 0x5198F8501BB46019u, 0x803AC8371716783Fu,
+    0x2AEEFC50060BF721u, 0x4FD83533F8DAD023u, 0xA5B716E443D0421Fu, 0x60EA6B8B063039EFu,
+    0x7E7132F10141BA9Eu, 0xDC69332391E77A3Fu, 0x420E5421DF988FF9u, 0x0AC232C85C4F6012u,
+    0x54BD5A51684C1874u, 0xD9D219A9C7178969u, 0x0237D1DF60C95B24u, 0x7CEB045509111834u,
+    0x072D9001B3A97852u, 0x308D8B3828B0C871u, 0xF5B8F4505E08DDB4u, 0xF774387E8A6125ACu,
+    0x7282E5540D6A3873u, 0xEA0ECA6D7C17F8AAu, 0x6E22AC0527F5297Fu, 0xEC05490FAE85EF25u,
+    0x7A6E838CEB7376A1u, 0x31492C39F7248180u, 0xE7FD4D6E38CB72D0u, 0xD65567AF4C53B62Du,
+    0x4431BB96278FB2E8u, 0xE5EAEB5E2A8B82B7u, 0xF8A5545A2862482Eu, 0x26F373D4A2963A2Bu,
+    0xC5ED82C54B4CCF5Du, 0xB53B413A5C68BDCAu, 0x5BF1191CF06392C4u, 0x8E28BCF5A5F72880u,
+    0x37BAE8149A4118CAu, 0xD9DFB164EF9AEBE0u, 0x729FBE6CF9C15F5Eu, 0xBC4887EA747C3AFBu,
+    0x22BA508F8F369583u, 0xECB5BFCA10767E4Du, 0xA38213F6943F339Bu, 0x90DF2EA9B4131047u,
+    0xFDC481A6E08D3489u, 0xBE4C09B8A70E96ADu, 0x5D7A3AFD585C6A66u, 0xBAAA277D97F717BFu,
+    0x292FCF783C555083u, 0x4A42E9805C97CB38u, 0x441BEC3220395988u, 0x9DC34227F56C9D86u,
+    0x0E2143640B0C620Du, 0xD9E8D392D8121310u, 0x662634EA3A72FDD4u, 0x7361F86246A03508u,
+    0xF1B58E0E00F61663u, 0x1320B16B1504E722u, 0x3BB49C99D4A65177u, 0x4D5B151CA9429724u,
+    0x4E52C30963810DEDu, 0x4A960C4F77F7E01Du, 0x7982C4E89D79A63Au, 0x68427713ED3E8223u,
+    0x08BD025ABFEA8FDDu, 0x89AFF41691F703A7u, 0xDED5FB0B860D3AD1u, 0xB98141A6DB306583u,
+    0xCC07C688F528644Du, 0x6B355EC27A6E60AEu, 0x32613C315696B9BFu, 0xA8B62C4AC5ECAF79u,
+    0xC8BB0590A2B82CAAu, 0x7D0540B8B314BEF2u, 0xB060DEC27CCB09A6u, 0x86812BF1C0CB9D3Du,
+    0x4ACAE3548FDB5AF8u, 0x6AF40CBEADC8115Au, 0x049B7A4DF146B8A4u, 0xEDA4B7455A8E0FCDu,
+    0x06FA94D456AFFD27u, 0xB1CC53633B0DC9E6u, 0x64A613E60BF7E63Fu, 0xD868272A86D9E7F3u,
+    0x3BD8657D2FC5E6E4u, 0xC88702000AF36EDBu, 0xECEA2E8B30BD28A1u, 0x8F5487254921CDDEu,
+    0x23C842F7CFD171BFu, 0xD33FF5E2C796D11Cu, 0x6733A5D0EBFC4DCDu, 0x22C0D448F6AAB1A7u,
+    0xA1E8899476845173u, 0x8133015B9EC462D2u, 0x28776CBFD386FFD3u, 0xE903FEE4F87AFFC3u,
+    0xADAC0896608533DBu, 0x7727D77BC28BFE4Au, 0x076C140AD4A0D9FDu, 0x3A95A189D5016980u,
+    0x5DB6FBB81152E4CBu, 0x5854AACA52B90A94u, 0x83BE4FCE47084FA0u, 0x723DDAA1EEF117D4u,
+    0x431D44F2D2A3A1F5u, 0x797DD3F30173577Fu, 0xE51CB4C4C7145C61u, 0xD047547CD7469776u,
+    0x1FF598180B648F65u, 0xE9D26FEC8DC894C5u, 0xD1D4BB6DD5BA05C9u, 0xFB7A315F07BE90CEu,
+    0xC1A0E6E49671A831u, 0x8E2CE6DCA338980Bu, 0xD0C21B16B339BCF0u, 0xC102B47984CC428Du,
+    0xB549D08BBC0D9EB9u, 0x429FA9E3D3FC32F2u, 0x512EB791E40A2793u, 0x1F37238FD61DD043u,
+    0x2999A0794FC5E441u, 0x367AAB901B8A96B9u, 0xAD110691F4B19E82u, 0x60F2DF01569A4A2Bu,
+    0x3AA5017D43B59446u, 0x914599D6EA340E92u, 0x2ED717595ACF06CEu, 0xDE25050F986782F6u,
+    0x0E92C2735282D942u, 0x81AB00B316F2CACDu, 0x785AECD59CE5B012u, 0xDA4D49331E8B3311u,
+    0x0BF388428E7C82D0u, 0x24D8D60DC4B13DB2u, 0x77BD0EEA5B25652Cu, 0x759AEB8EFA15F2FDu,
+    0xC1C520CDA10B91DEu, 0x28F31B3D4579066Au, 0x6B61CE067DE83625u, 0x9EF10119C6EA1F79u,
+    0x623C1510BB0E241Au, 0x90DE6EAD4A4C52A3u, 0x38BB9CB74CDE287Cu, 0x3C35DB15F8E4D2E9u,
+    0x83F15193B5F2E8D9u, 0xAB0026DD01B8BFA1u, 0x13D2D3A1E85AAD31u, 0xAE8F986703E7209Eu,
+    0x71EAAB42EC420233u, 0x4982C211FC5C7146u, 0x2FE3B21FF37F639Au, 0x5787617A269F07EFu,
+    0x20B6B9B70B10EC5Cu, 0x095823C875EA930Au, 0xB60D4605F3635E08u, 0x557DB82DFF8F5167u,
+    0xA6EA24F69F98FA3Du, 0x72C63D1CC0BE72ABu, 0x376D6AE13D88E5BCu, 0x7CB35047F1CB104Fu,
+    0x762A083E44B24DB0u, 0xCEAD16A42EEFCFFBu, 0x5B737E5025AA916Bu, 0x170616909355C961u,
+    0x63A7D2DA739C7D25u, 0x08AC13D5E5D15EC2u, 0xF907830298F666A9u, 0x000000000F791274u};
+  _::mersenne_twister_jump(e, polynomial);
+}
+
+/// Advances @p e by \f$2^{64}\f$ notches.
+inline void jump(std::mt19937_64 &e)
+{
+  static constexpr std::uint64_t polynomial[] = {
+    0xE60FB02AABDF1FC7u, 0xC65F69DE9A480A53u, 0x513407D51477F1E2u, 0xA2E413D59B3A2033u,
+    0x02AC43A11C0C0FC1u, 0x5F36E214509D4385u, 0x935AC11DAABC5994u, 0x86BE7D6015C54C21u,
+    0x138068C8D73C65A0u, 0x78717E9F9B62B6DEu, 0xD867433450A2E740u, 0xC1E691CD4143935Bu,
+    0xD43742FA9D119545u, 0x3CF23CB9926B4587u, 0xE638A5474481B0AFu, 0x177EE6276C3CE42Cu,
+    0x1F27194CE0601D1Fu, 0xD4785713CB2611B4u, 0x4BA3378AA482C62Du, 0x2DD12B3AA35FE642u,
+    0x4884DD03590DE141u, 0x67604E8F8FDC984Eu, 0xD17C87BD8932DAA0u, 0xD2B51C9FCE8F2C90u,
+    0xB4B5FA4B1B4CD098u, 0x463FA4C2EE540AD8u, 0x04E833507316A4A5u, 0xE5FD115542A749E8u,
+    0x682405A771501277u, 0xFE81E7FA28F1336Fu, 0xB4DF66AB7E6E2EFBu, 0x233F73ED8AAD5BEDu,
+    0x52F16FE971EFF245u, 0xC2E0FA23D3848E2Eu, 0xFF652EE86FFA3DD1u, 0x6E26674A904E2D08u,
+    0x842EDFDD6EF5E24Bu, 0x9028AB05254E1FA4u, 0xF024D8C74BE6E9EFu, 0x7C7C67D91F048CD8u,
+    0x25BAB81D318C0A5Au, 0x4996909EA998303Cu, 0xE785C52C35A007F2u, 0x070A7E9E29D83601u,
+    0x613DA2C6FE52DA55u, 0xE0D2D253AC59080Au, 0xEC7CE4A302A76425u, 0xDDBC99123C31E045u,
+    0x819E68FB087B366Eu, 0x6D7ACCF77A78B20Bu, 0xE8E83E74CA114741u, 0xA036017C3D964405u,
+    0xC7CBF0F696DA1D0Cu, 0xCA28080829A08A0Du, 0x441FE5CE905EF459u, 0xAD4BD3C2AFA1191Au,
+    0x5670C82DAA8D97DAu, 0xB63AC15D5A47068Bu, 0xE31C108157AB7B31u, 0x5B3679AECFE137A6u,
+    0xC67437C81637DEA7u, 0x19CACF1B34E2DFF0u, 0xCDE6FEC2CC32159Cu, 0x89E27B2F093D39AEu,
+    0x4B38DF61862A095Fu, 0xC8963C0945C0C6C1u, 0x4C7B1532C737653Bu, 0x0EA5B2D221EF5AD3u,
+    0x7F6DEE0774791665u, 0x7C57B3984958EDAAu, 0xAEC9F411D71CFE91u, 0xBD1545EA0EB0916Eu,
+    0xFB419D328082C92Fu, 0xBA88E5FACE940313u, 0x561362607289396Du, 0xA6D7E61126DC4BCDu,
+    0x584A5A98A4500334u, 0x7C12BCCFF51C77F5u, 0x34F9F6951151505Fu, 0x670B7F25981FAAF1u,
+    0xC1524B8B38197C81u, 0xEF2AA635287E1D65u, 0x5DFC26B06221E0F4u, 0xDA175E5EDBB8C45Cu,
+    0xDDE130D0E54E47C8u, 0xEA02E7D666F77AD8u, 0xBE37D3598C5E7F31u, 0x3B4524D0E613D328u,
+    0xEB125F4BD2C90CDAu, 0x15F5AFF8644FDEA7u, 0x5D16B18B865181CFu, 0x2E1BFB2089C49A36u,
+    0x54EEF62DA9155940u, 0x0C56C2394BA5B6F7u, 0xFF4C41A3220B890Au, 0x40E5FF32733970B9u,
+    0x4834D77D4CE109AAu, 0x70151EE670421D43u, 0x2426AED610274CD5u, 0x76B49FE3BEFC5ECDu,
+    0xE47E4548ABFE516Au, 0x4D6C7810792E3BB6u, 0xB5D34069874FE687u, 0xAC445A00E901FECFu,
+    0x82EE0C49D9DEE336u, 0x4BE9E7BBAAFB6D4Au, 0x0E668B788FAA19A4u, 0x2BDCB00BBB953CABu,
+    0x2BABC2637816D150u, 0x5EB7EB3EAA1CA857u, 0x29EB3FDAF69A1D30u, 0x12A3CC6796857BD0u,
+    0xB856CFA71C4A1295u, 0x24B508B4347E4014u, 0xB470D89D91CEAB28u, 0xB0BD1299421D6FAEu,
+    0xE0305361D1789E75u, 0x8B95E548D237FCAEu, 0xD180D85317FAC132u, 0xD3FF723D07C4DDBFu,
+    0x181DB37B3E537D52u, 0x5CA6AA58B9FF9D46u, 0x302B8CD936DB7516u, 0xD3A5F6030758B90Au,
+    0xF56E827199C34EDCu, 0x8FB935E92E3CE513u, 0x5175AF3057609C16u, 0xDC22D55638A7532Au,
+    0x93803EB592D12EA1u, 0x726F44C149F131DBu, 0xD841986DA5F7E703u, 0x8C6D207760AC21A4u,
+    0x5AD0E18C08B31C73u, 0xE47FEDB1975C446Cu, 0xE8C47EE653BB75F4u, 0x6E61E2339DC98E6Cu,
+    0x5C376345105C2560u, 0xB960F2FA0BA3E356u, 0x098BD79978F20FA8u, 0x29A589FFB6BE4B07u,
+    0xC10AB33D25A519DCu, 0x888C2676CE6A9C9Bu, 0x949EED9F6E19A46Eu, 0xA15CD52E784C0483u,
+    0x85230945E0C94B51u, 0xD1606A2E1470AD2Cu, 0xA2735C82C346739Au, 0xBF2228080B8CBD45u,
+    0x103046CEE1B672D3u, 0x85F83F74444EC995u, 0xB1F07F3DD63F7CC4u, 0x48B35C24E5A25628u,
+    0x8661F2DA6712A45Eu, 0x55B7F76CDA81B368u, 0x23F3F6BF64D244A9u, 0xDAEC2CF98BA362C7u,
+    0x275880F4564668E6u, 0xCD5C2D91DF674276u, 0xF86AAC35169D323Du, 0xA917D0CA6B3E6F9Fu,
+    0xCD31FEE3F8EE305Cu, 0x8538FDDF3B32AC55u, 0xA12F3212CC1A736Au, 0xA01828BABB85F50Eu,
+    0x3E2FC0C04CD334F7u, 0xCD3C82F2B50D3156u, 0x38B0022A4ADECA96u, 0x7F6E69DD40B29D9Cu,
+    0xCB7587220C117A8Au, 0xD97508E621A30FC5u, 0xCCDBA98CBEB7B024u, 0x40A3C5B3B26C01B6u,
+    0x3562C53119B6E667u, 0xC36E7828B83BF68Bu, 0xAF8298D19F1A6113u, 0xB555ABBB9B42EF39u,
+    0xAAAE4427D63E3EB5u, 0xCE9F0740AC9BDCE9u, 0x68CAEBC59B487F2Au, 0x44659133823D56D4u,
+    0xAE4565196A27EA70u, 0xB62DA982920BB58Eu, 0xCA464023611E41BDu, 0xD80F095365CD5BE5u,
+    0xB4845D2B9CB626A1u, 0xDBE1279369FAD28Cu, 0x29B8DCB3E2140769u, 0xCDCE60398F47F67Au,
+    0xF0B62D8813F085F8u, 0xE539FED317B8DF3Eu, 0x3A6929C164FCB973u, 0x60D22C4D61EBF74Bu,
+    0x9FD0076889AB4BCCu, 0xCE9316F20A51F654u, 0x4D0B6FC7D41EED5Au, 0xB9517AEBB5B112F5u,
+    0xA27F8A85F73A4CA7u, 0xFD5A71448AF8EBF2u, 0x7283CB70BAE7596Bu, 0x565694C57ED3D283u,
+    0x012AF16EBA0A8FE0u, 0x87508B9E4A3FCCE1u, 0xA974113D6D3DA7FCu, 0xC4B3446CDFD8D1BAu,
+    0xC7CCAA13F83F1BACu, 0x52597EC45F3C7396u, 0xF7475FFB51D77E73u, 0x5FB9A490535F16A2u,
+    0xDEB6461C057DDAB7u, 0xCABE494F35F351B6u, 0xBC72E04F2E5594E5u, 0xF7BB0647D8FF22D5u,
+    0x40B51B5A86808C37u, 0x5A10B2E3C479518Bu, 0x45C8E16A202FB696u, 0x3F0D2C56FF25A4FBu,
+    0x298CAA4F7EE58354u, 0x71F675C470352718u, 0xC2C73A11C90CAD89u, 0x9E69F82FA56C3ABDu,
+    0xCFB01CDBB54F7644u, 0xA2014521F4C0C288u, 0x66DAEE23B6286477u, 0xACFEE4FE7BA56BD4u,
+    0xB1D65032127C0155u, 0x97ABBA513F82D23Cu, 0xEE16881E74D9D39Fu, 0x7043FBA9437788E8u,
+    0x50924705F5C679CDu, 0xB8AF885116C2B750u, 0xD7A6B99BCFC51365u, 0x695782D68BD9578Cu,
+    0x4BAC338E7950B251u, 0x43D135BB69F2279Bu, 0x9518F77CE579B7C9u, 0x109553FE25D4DD5Du,
+    0xEE12F97AA0754CABu, 0x40A8016A8BFE1D6Du, 0x58433C86D3FCC596u, 0xA11B8205C8383934u,
+    0xCE1E1678FE7CB440u, 0x51123162DED427C7u, 0x3B12E90FB6B3497Cu, 0xD29E53EEEB1268F7u,
+    0x7340D2C99FF98155u, 0xAA15805D2B321851u, 0x67F5CA730661CC90u, 0x3606844C24AC0B7Eu,
+    0x2EE5F00F10399A4Au, 0x1DD2CDA7ACE9845Au, 0x9F21E3F0038C028Bu, 0x083E47A4360D6E10u,
+    0x4FED371AB06EA3DEu, 0xB87AF3AA5C7E9010u, 0x3ED423D23C9686BCu, 0xD35E702DA30DBC3Eu,
+    0xA3B89345D7A5C74Du, 0x8AB2D01AC20C1727u, 0xBDB1349CB7423EA7u, 0xEC24A89066EC2F2Du,
+    0x40DC6F279E3F692Bu, 0x31906190F383CC97u, 0x9074288F9A23A8F7u, 0xB0EEF9E29F1C2B44u,
+    0xC194F118A093FEF6u, 0x738F305F5BD0CC97u, 0xD6F766D3E58C4BDCu, 0x73B5B8E1196FBC4Au,
+    0x4A7126119253D1AFu, 0xE5922B17DC8F3F80u, 0x9FC67810BADF75E1u, 0xFBF6CDCCC6A89FD7u,
+    0xF9A8A606B2C78A15u, 0xB57935E65AB7493Du, 0xA14864BDA35F1AB3u, 0xF579B34AFE11E831u,
+    0x9F844DD3D61CFAF6u, 0xB8B746FB9FD8B52Au, 0x5865526F869C5C30u, 0x73B647D8C93ABBE9u,
+    0x69232193D0DA092Du, 0x4A19FEFFC0B3AF47u, 0xFBFEF576669E2816u, 0x11C301F54C725AD3u,
+    0x0909756E8A29DF37u, 0x2AF6D8BAF61FEAC8u, 0xDE2131B64A6E3FDDu, 0x0B9C1A62D9DA3323u,
+    0xA9B8DBC8398601DBu, 0x70976E59664D8193u, 0xAA9851BC6FAC410Eu, 0x56BE6988A7875E9Bu,
+    0xE7F5F90A986B9DADu, 0xEA9E2DEA8AA84929u, 0x35A18FC398FF69A1u, 0xF0FA956D587A9F96u,
+    0x8291B2D752622F62u, 0xBE3053293D1474F4u, 0xFD57AE06743BF23Eu, 0x79A7A12511ED40A8u,
+    0x72C7BD32F0027A0Eu, 0x834EF09A8DC51FB8u, 0x56134CD9429444DEu, 0xDAD533F2AF653B99u,
+    0x6AA1E78CE4537479u, 0xF4978FC8F0AD4D14u, 0xF6A058F4D0F184DCu, 0x0534F598F349A714u,
+    0x1F2C1C11CC7B57AEu, 0x3E8FA5F3070D459Cu, 0xFC866F153FDA094Du, 0x00000001EBC8161Eu};
+  _::mersenne_twister_jump(e, polynomial);
+}
+
+/// Advances @p e by \f$2^{128}\f$ notches.
+inline void long_jump(std::mt19937_64 &e)
+{
+  static constexpr std::uint64_t polynomial[] = {
+    0xE5262EDB3947384Fu, 0xE8DBE8BC6168161Du, 0x552A7F8A909E5996u, 0x7AE186FE858D9ADAu,
+    0xA626D3D5C3C9781Eu, 0x98F5550062247FCBu, 0x5B0A34A4146A34F2u, 0xD35659725684F831u,
+    0xB79DB1F77395F208u, 0xF5C348A32CECAC5Cu, 0x58CC38B6123ED794u, 0xD191A00B3E362C4Bu,
+    0xFED421B5A1B55964u, 0x89BCC240E26E3328u, 0x06DC4E1C13CC03A7u, 0x92188467E9A1E6DEu,
+    0xAC0427A245A59975u, 0x396D921AD8BA9AC5u, 0xB7F21F270E15160Eu, 0x28A2A3D46BE04DAAu,
+    0x815EEB2E91AA0550u, 0xBA386F6309E7DDD0u, 0x7AA2D3CB29FFF2CAu, 0xC62EB2F81D8634DAu,
+    0x6CFE9B7DD64A679Au, 0xC3BD22442119535Cu, 0x902A73A39384E1A2u, 0xF5EDDF0CE5AF27D4u,
+    0xE7DE5E359401F618u, 0xC4524F942F884D2Fu, 0x3857B7FB97649EB1u, 0x930CD5A1830B9DE8u,
+    0x305413C76BA04ACBu, 0xED61BA7DFC907582u, 0xC3C984C6070A6C88u, 0xC31B486A6B91E7CBu,
+    0x6147E50886F57AB4u, 0xB611DBE934CB0FA4u, 0x5246952DD7012A63u, 0xF1B2BE7B6814B670u,
+    0x215CA6E78D45A034u, 0x2B674AE10418B5EBu, 0xB65BD80D3FD8DAC7u, 0xBC0C6A9B5E0F1B2Fu,
+    0x0C7BC0F20C26BC77u, 0xDD1343F069FA597Cu, 0xFCDF6EF10C69BC36u, 0xE2ECE971A260F1F6u,
+    0x7E1DB9A5DE8F0156u, 0xEC78EF6CC9859BC2u, 0xD31E5094309694D1u, 0xCBE7BECDD0314DB4u,
+    0x4A8B310699F06AF8u, 0x13921DD25AC16686u, 0x9A7D929F9B7FAA1Eu, 0x247B5921C1DACDE0u,
+    0x08885F6FA9F9B2F4u, 0x32273406A986F2AEu, 0x68E8F62142A110BFu, 0x9496AAD678097737u,
+    0x52514E868848B1E4u, 0x5AC11875E31451B5u, 0xC3D01326BD3B4B0Bu, 0x3A5CE9B2CCF55BF9u,
+    0x57C454DE7415D6EBu, 0x0A46EB592B1E519Du, 0xF5F765AF1E7188F7u, 0x94EF0AC12148F809u,
+    0x89A7E4B40449F815u, 0x9C2FCF91EBCA5C18u, 0x03B721F5217E7BBCu, 0xA7E1373738DF8240u,
+    0x6A7C07B8E3C9332Cu, 0x7DFC2444E92F2A82u, 0xC0EF98F68F155A80u, 0x7820609167F2D4FFu,
+    0x01A3442E33CE6F4Bu, 0xC40B57D98D7F8EF5u, 0x2E852E98D8BE63EAu, 0xA5C06667AFB32C88u,
+    0x61FF578FDF9D6FDCu, 0xEFEA3C06B708D19Bu, 0x24BDAEBE6B0C2AFDu, 0xCC88EC820EAC0FCDu,
+    0x8E1F9260758339A6u, 0xA9ACAE9C292C4124u, 0x3032D1CBB31CF5D4u, 0x4B574390715C5AD7u,
+    0x6F6F5F354266DF76u, 0xC4150013CC941292u, 0xA0B53044DBE91A60u, 0x30635D3AE8D785ECu,
+    0x8202F63E3E107FADu, 0xCB476EE8688E0BCBu, 0xE4591E05B8E036A2u, 0xBD6DBFFC959C33E3u,
+    0xC93A20B1CD9BA6ECu, 0xC4CA906E69CC2D92u, 0x6A9BBC5B1DBB93F5u, 0x67500782BD1B7E9Eu,
+    0x6AC1F7F27535ECC3u, 0x5223B3178995C738u, 0x2A3D81343948075Au, 0xE38FCACA1599F828u,
+    0xBB1A24593DCFE24Bu, 0xA12B84186C45B364u, 0xAB0109868EEA202Au, 0x8DF9B96A9752E935u,
+    0x0CC28C8A24670058u, 0x8658AA03FD5820CFu, 0xB7907411D0B0872Cu, 0x01A19DAF25F30B3Cu,
+    0x2DDC019588BE4530u, 0x812F0DF2F0AEF518u, 0x15402344FFA07AD9u, 0xD335A4B06BCAE030u,
+    0x816A0E0C6CBB7ABAu, 0x766A9B19E52B6A38u, 0x1C3B7AF26281F0E8u, 0xE01913830022AC78u,
+    0x8B7BF04881A1A1CEu, 0x404D5BF0CFA62DA1u, 0xB609D2FAE7C762B1u, 0x0797289CCA0D3675u,
+    0x5AD3FB6418E4CC33u, 0xBBAFA0647E61AFF6u, 0x9F507106EE45C37Eu, 0x148A81FE5D0A6907u,
+    0x73768DF926A7F6D4u, 0xB5C7A7027D003647u, 0x1071E3F43FB3FE3Fu, 0xF47F8F20F7907AB8u,
+    0x0AD3A01C017DD483u, 0xEA28979265A6A458u, 0x4B217F895D792A6Du, 0xAA7E96A66BF4A9F7u,
+    0x34B398AABC021B06u, 0x033AD4E061B705F6u, 0x5EE2BF91C2EA9E1Du, 0x8FB2F08479D39D07u,
+    0xA668CB9B9BAAA7FFu, 0x258EF3C71932DB78u, 0xA4FDDAC73138CFDFu, 0xB39A176AA98BA349u,
+    0x4E3D8A45557BDBC0u, 0x00939204C831E5C7u, 0xBDE0050F5D3B6C22u, 0x321D94C01B34156Fu,
+    0xFFB57FC1752B3D49u, 0x1EBA75AEF52776E4u, 0x18F24E8054A82DBCu, 0x9A88388E9AF3BC65u,
+    0x15F9895D23793BF2u, 0x7089A4F12E283439u, 0x6FE2544F83C4997Bu, 0xD837C9FA3346F327u,
+    0x1616EC2DD8A25ECBu, 0x0F003BBFDA576878u, 0x750E58812D2255A2u, 0x394F818BE9AEFF08u,
+    0xEEE31FDF2BCEA017u, 0x2AE89C6E158F3FDCu, 0x2A2ED38677470038u, 0x546FCE260192AAE2u,
+    0x7F2AB6157ABDD217u, 0x0B3A4A0323A2874Eu, 0xB23BEF7C196387CEu, 0xEFB5418B1A20904Cu,
+    0x59D2311628820E65u, 0xCA7A23DDFD16129Du, 0x3CC081156E1CAFB6u, 0x61D67D0A38529BEAu,
+    0x3E94276CCBD611AAu, 0x3771F3B213DE600Au, 0x21E00BBED986F832u, 0x3EC36E342578BEF4u,
+    0xC249F0A082B2C6BBu, 0x78467F961407157Cu, 0x0D04371569691E5Eu, 0x3D542ACBCFEC7D0Fu,
+    0xAE1E5EE563F709EFu, 0x72DC126DB599BA74u, 0xDFEAB969FE872BC3u, 0x321101F23C5CD2A7u,
+    0x17DBA0F541DB11B5u, 0x9568E6CB91205C85u, 0xBAD64ECE4A1D6354u, 0x1F40BFAB48C9427Au,
+    0x469366DDDCEDB23Fu, 0xB8C9BBC8FD17A879u, 0x881FF11AC4FBB3A7u, 0xA0B1D5AC0C7A578Cu,
+    0x2C93743EFA9E9706u, 0x655D05B5ECF0A9EDu, 0x53695E0FA22A9D74u, 0x335BB8E887C19B1Fu,
+    0xF4F3609D40423274u, 0x82F568C2121DEB57u, 0x8B3141721391FC28u, 0xCCE30200B768469Fu,
+    0x3C49361C58DF6C54u, 0x749ABB2739D7E821u, 0x8E3FB1739BB024C9u, 0x053FF0D5A2385C26u,
+    0x7FC3F3500BE6B460u, 0xEA4A53187E13D377u, 0xB830796D57008DF2u, 0x3FAC39E03D15C8EBu,
+    0x149EBFBF9371F5EFu, 0xC9A3DAADA4C3B184u, 0xC73586121B2B22F9u, 0x8C74CB2A142CAE6Eu,
+    0x71E079AA37334E9Eu, 0x69599461D3C9525Fu, 0xF21324943980CFFAu, 0xE5EF3C6EB18325CCu,
+    0x68C7ECE59676D433u, 0x057ECFAA0CF8C9E6u, 0xB6A5E05F8247D5E9u, 0xA5AF46E888104205u,
+    0x29E0C8436CDD6301u, 0x2F57593904BA61D3u, 0xD67ABFFA9773FDD3u, 0x2AC6A9EA01C9E370u,
+    0x089B5CAEFABA0AC3u, 0x72FDD9F2A770AA93u, 0xC529FFF58E1EE093u, 0xE7AE2809097EA6FFu,
+    0xF645F5AE7384B63Fu, 0xE176641A400E5C76u, 0x619940EB0AA9168Au, 0x46E31DDC7BDFF59Bu,
+    0x15FDA081CC260B7Eu, 0x0E446449DDB03A45u, 0x196780A4C106F14Eu, 0x725EBC1EF9D6EEBFu,
+    0x023AED700BB72FDCu, 0x9ECECFE062F75384u, 0x823AC874CED22CC7u, 0xC382DE09D280FD06u,
+    0x01C28526F13E350Du, 0x09CBECA4CBFFF94Fu, 0x5857F8CD86826440u, 0xC79B041DF499F29Eu,
+    0x7858020137A7BB94u, 0x51DB6F9855926972u, 0xA86EC1F4423D4175u, 0x9CB08B217C241386u,
+    0x87707DE358526B57u, 0x896999D1219EE796u, 0xB317A4339B9FCFA6u, 0xC7B19CEBE2CCFAC9u,
+    0x40B734DFEAE00C34u, 0xF22CEBF88D47C529u, 0x00AC8A2CB14C4E72u, 0xC15B3E21A8E71185u,
+    0x110CF443071EABBCu, 0x0DF93EEB4277A0AEu, 0xF613B204858ED3F0u, 0xAB830B18776D9C37u,
+    0xF5F99B412BF70BEBu, 0x2B00277E9DF35221u, 0x1E836A42EC71A14Bu, 0x459F153816488DE4u,
+    0x438076134C818AFDu, 0xA2E30EB79384539Du, 0x8BF18A4CDFAB9EB2u, 0x9776FC6AFEEBB940u,
+    0xD0DF30D8D681F6C5u, 0xE9180ABCA98459FEu, 0x02AD70F7A14CCED3u, 0x86248BE8D8A7E866u,
+    0xCB5A108171B2AEDFu, 0x7606A59C346B5B13u, 0x2357668C2CEBA1E9u, 0x7A45D842DFB1AF12u,
+    0x85EACD9FCB1DFBDDu, 0xE56C43182E344824u, 0x0ED1B51DF09E1899u, 0x169F9B476B6C1BBCu,
+    0x76754F21A5CD8869u, 0x3BF0A0CE9B6717BEu, 0xF8B24B3574EC1F59u, 0x637219371EE79E42u,
+    0x3C0E7B7FDA30AD4Eu, 0x4DAEC06898C72E2Du, 0xE1115506FEA1D7E2u, 0xAA1E2FDC12FB1752u,
+    0x83C09F42977F41BFu, 0xEEE2C742C6837A46u, 0x7CA1114BD92435C5u, 0xA121641B4DD2DD77u,
+    0xDE359F7D9C1F27D0u, 0x6B95FDC2F2DFDB41u, 0x3F06382069FC5218u, 0x15DD4512D1E94680u,
+    0x4698155B1804AD9Au, 0x21E3613A2044352Au, 0x0978A939EBEF57E2u, 0x80F7EDA58A2A8CBBu,
+    0x484F64391CCB4A2Cu, 0xF5F31BEB102E348Cu, 0xF19E5D2976A54D82u, 0x1F73C7E9DDF3256Fu,
+    0xCDDC16EF95B0DA1Fu, 0xD9E4DAC42606845Cu, 0x363C63D4CFC368E3u, 0x398F7C2A7F784681u,
+    0xAAE7C371AB145DF8u, 0x644EA809991BED7Au, 0x4F1D9F1C3733ADD4u, 0x000000014B915623u};
+  _::mersenne_twister_jump(e, polynomial);
+}
+
+/// @}
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_jump_hpp
@@ -0,0 +1,309 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_multivariate_normal_distribution_hpp
+#define abz_random_multivariate_normal_distribution_hpp
+
+/// @file abz/random/multivariate_normal_distribution.hpp
+/// Multivariate normal distribution sampled through a Cholesky factor.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/simd.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class multivariate_normal_distribution
+/// @brief Vectors of correlated normal values.
+///
+/// A vector is \f$\mu + L z\f$, where \f$z\f$ holds independent standard normal values drawn with
+/// the Ziggurat method (see @ref normal_distribution) and \f$L\f$ is the Cholesky factor of the
+/// covariance \f$\Sigma = L L^T\f$, computed once when the parameters are built.
+///
+/// The values of a vector are written one after another to contiguous memory, and generate()
+/// writes whole blocks of vectors: the normal values of a block are drawn in bulk straight into
+/// the output, then multiplied in place by \f$L\f$ with the vectorized kernels, a few columns of
+/// \f$L\f$ at a time so that they stay in the L1 cache across the block. Nothing is allocated while
+/// generating.
+///
+/// @code
+/// abz::random::multivariate_normal_distribution<double> d{mean, covariance};
+/// std::vector<double> paths(n * d.dimensions());
+/// d.generate(paths.data(), paths.data() + paths.size(), engine); // n vectors
+/// @endcode
+///
+/// @tparam Real A floating point type.
+template <class Real = double>
+class multivariate_normal_distribution {
+  static_assert(std::is_floating_point<Real>::value, "Real must be a floating point type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = Real; ///< The floating point type of the values of the vectors.
+
+  /// The parameters of the distribution: the mean, the covariance and its Cholesky factor.
+  class param_type {
+  public:
+    using distribution_type = multivariate_normal_distribution;
+
+    /// A single standard normal value.
+    param_type() : param_type(1) {}
+
+    /// @p dimensions independent standard normal values.
+    explicit param_type(const std::size_t dimensions)
+      : param_type(std::vector<Real>(dimensions), identity(dimensions))
+    {
+    }
+
+    /// Mean @p mean and covariance @p covariance, given by rows (only its lower triangle is read).
+    ///
+    /// The covariance must have the square of the size of the mean values, and be positive
+    /// semi-definite. See positive_semidefinite() for the other ones.
+    param_type(std::vector<Real> mean, std::vector<Real> covariance)
+      : mean_(std::move(mean))
+      , covariance_(std::move(covariance))
+    {
+      factorize();
+    }
+
+    /// Returns the number of values of the vectors.
+    std::size_t dimensions() const noexcept { return mean_.size(); }
+
+    const std::vector<Real> &mean() const noexcept { return mean_; }
+    const std::vector<Real> &covariance() const noexcept { return covariance_; }
+
+    /// Returns @c false when the covariance is not a positive semi-definite matrix of the right
+    /// size. The negative pivots of its factorization are then replaced by zeros, and the
+    /// vectors do not follow the covariance.
+    bool positive_semidefinite() const noexcept { return positive_semidefinite_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.mean_ == rhs.mean_ && lhs.covariance_ == rhs.covariance_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class multivariate_normal_distribution;
+
+    static std::vector<Real> identity(const std::size_t n)
+    {
+      std::vector<Real> m(n * n);
+      for (std::size_t i = 0; i < n; ++i) m[i * n + i] = Real{1};
+      return m;
+    }
+
+    /// Cholesky-Banachiewicz factorization, in double precision, into factor_ packed by columns.
+    /// Pivots that are null up to the rounding errors give null columns, so that singular
+    /// covariances (e.g. perfectly correlated values) are supported.
+    void factorize()
+    {
+      const std::size_t n = mean_.size();
+      factor_.assign(n * (n + 1) / 2, Real{0});
+      positive_semidefinite_ = covariance_.size() == n * n;
+      if (!positive_semidefinite_) return;
+      double scale = 0.;
+      for (std::size_t i = 0; i < n; ++i) {
+        scale = std::fmax(scale, std::fabs(static_cast<double>(covariance_[i * n + i])));
+      }
+      const double tolerance = static_cast<double>(n) * std::numeric_limits<double>::epsilon()
+                               * scale;
+      std::vector<double> l(n * n); // By rows.
+      for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+          double s = static_cast<double>(covariance_[i * n + j]);
+          for (std::size_t k = 0; k < j; ++k) s -= l[i * n + k] * l[j * n + k];
+          if (j < i) {
+            l[i * n + j] = l[j * n + j] > 0. ? s / l[j * n + j] : 0.;
+          } else if (s > tolerance) {
+            l[i * n + i] = std::sqrt(s);
+          } else if (s < -tolerance) {
+            positive_semidefinite_ = false;
+          }
+        }
+      }
+      for (std::size_t j = 0; j < n; ++j) {
+        Real *column = factor_.data() + _::packed_column(j, n) - j;
+        for (std::size_t i = j; i < n; ++i) column[i] = static_cast<Real>(l[i * n + j]);
+      }
+    }
+
+    std::vector<Real> mean_;
+    std::vector<Real> covariance_;
+    std::vector<Real> factor_; // The lower triangular Cholesky factor, packed by columns.
+    bool positive_semidefinite_;
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  multivariate_normal_distribution() : multivariate_normal_distribution(1) {}
+
+  explicit multivariate_normal_distribution(const std::size_t dimensions) : p_(dimensions) {}
+
+  multivariate_normal_distribution(std::vector<Real> mean, std::vector<Real> covariance)
+    : p_(std::move(mean), std::move(covariance))
+  {
+  }
+
+  explicit multivariate_normal_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  /// Writes a vector to \f$[out, out + dimensions())\f$, and returns the end of the vector.
+  template <class Engine>
+  Real *operator()(Engine &g, Real *out) const
+  {
+    return generate_n(out, 1, g, p_);
+  }
+
+  /// Writes a vector of the distribution of parameters @p p to @p out.
+  template <class Engine>
+  Real *operator()(Engine &g, Real *out, const param_type &p) const
+  {
+    return generate_n(out, 1, g, p);
+  }
+
+  /// Writes \f$\lfloor (last - first) / dimensions() \rfloor\f$ vectors one after another to
+  /// \f$[first, last)\f$. The remaining values, if any, are left unchanged.
+  template <class Engine>
+  void generate(Real *first, Real *last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Writes vectors of the distribution of parameters @p p to \f$[first, last)\f$.
+  template <class Engine>
+  void generate(Real *first, Real *last, Engine &g, const param_type &p) const
+  {
+    const std::size_t n = p.dimensions();
+    if (n != 0) generate_n(first, static_cast<std::size_t>(last - first) / n, g, p);
+  }
+
+  /// Writes @p count vectors one after another to @p out, and returns the end of the last one.
+  template <class Engine>
+  Real *generate_n(Real *out, const std::size_t count, Engine &g) const
+  {
+    return generate_n(out, count, g, p_);
+  }
+
+  /// Writes @p count vectors of the distribution of parameters @p p to @p out.
+  template <class Engine>
+  Real *generate_n(Real *out, std::size_t count, Engine &g, const param_type &p) const
+  {
+    const std::size_t n = p.dimensions();
+    if (n == 0) return out;
+    const std::size_t block = n < 16384 ? 16384 / n : 1; // Vectors that fit in the L2 cache.
+    const _::simd_isa isa = _::simd_isa_in_use();
+    while (count != 0) {
+      const std::size_t m = count < block ? count : block;
+      _::ziggurat_n<_::normal_ziggurat>(g, out, m * n, [](const double z) { return z; });
+      _::lower_triangular(isa, p.factor_.data(), p.mean_.data(), n, out, m);
+      out += m * n;
+      count -= m;
+    }
+    return out;
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  std::size_t dimensions() const noexcept { return p_.dimensions(); }
+  const std::vector<Real> &mean() const noexcept { return p_.mean(); }
+  const std::vector<Real> &covariance() const noexcept { return p_.covariance(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return std::numeric_limits<Real>::lowest(); }
+  result_type max() const noexcept { return std::numeric_limits<Real>::max(); }
+
+  /// @}
+
+  friend bool operator==(const multivariate_normal_distribution &lhs,
+                         const multivariate_normal_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const multivariate_normal_distribution &lhs,
+                         const multivariate_normal_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const multivariate_normal_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<Real>::max_digits10);
+    os << d.dimensions();
+    for (const Real x : d.mean()) os << os.widen(' ') << x;
+    for (const Real x : d.covariance()) os << os.widen(' ') << x;
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       multivariate_normal_distribution &d)
+  {
+    std::size_t n;
+    if (!(is >> n)) return is;
+    std::vector<Real> mean(n), covariance(n * n);
+    for (Real &x : mean) {
+      if (!(is >> x)) return is;
+    }
+    for (Real &x : covariance) {
+      if (!(is >> x)) return is;
+    }
+    d.param(param_type{std::move(mean), std::move(covariance)});
+    return is;
+  }
+
+private:
+  param_type p_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_multivariate_normal_distribution_hpp
@@ -0,0 +1,194 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_pareto_distribution_hpp
+#define abz_random_pareto_distribution_hpp
+
+/// @file abz/random/pareto_distribution.hpp
+/// Pareto distribution sampled from exponential values.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class pareto_distribution
+/// @brief Pareto (type I) distribution sampled from exponential values.
+///
+/// Satisfies the RandomNumberDistribution concept. Values are at least the scale \f$x_m\f$, with
+/// \f$P(X > x) = (x_m / x)^\alpha\f$ for the shape \f$\alpha > 0\f$.
+///
+/// A value is \f$x_m e^{E / \alpha}\f$, \f$E\f$ being a standard exponential value drawn with the
+/// Ziggurat method of @ref exponential_distribution: an exponential and a multiplication per value,
+/// instead of the power of the inversion. generate() fills whole ranges at once with words drawn
+/// in bulk.
+///
+/// @tparam Real A floating point type.
+template <class Real = double>
+class pareto_distribution {
+  static_assert(std::is_floating_point<Real>::value, "Real must be a floating point type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = Real; ///< The floating point type generated.
+
+  /// The parameters of the distribution.
+  class param_type {
+  public:
+    using distribution_type = pareto_distribution;
+
+    explicit param_type(const Real shape = Real{1}, const Real scale = Real{1})
+      : shape_(shape)
+      , scale_(scale)
+      , inv_shape_(1. / static_cast<double>(shape))
+    {
+    }
+
+    Real shape() const noexcept { return shape_; }
+    Real scale() const noexcept { return scale_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.shape_ == rhs.shape_ && lhs.scale_ == rhs.scale_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class pareto_distribution;
+
+    Real shape_;
+    Real scale_;
+    double inv_shape_;
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  pareto_distribution() : pareto_distribution(Real{1}) {}
+
+  explicit pareto_distribution(const Real shape, const Real scale = Real{1}) : p_(shape, scale) {}
+
+  explicit pareto_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return transform{p}(_::ziggurat<_::exponential_ziggurat>(g));
+  }
+
+  /// Fills \f$[first, last)\f$ with Pareto distributed values.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values following the distribution of parameters @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    _::ziggurat_generate<_::exponential_ziggurat>(g, first, last, transform{p});
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  result_type shape() const noexcept { return p_.shape(); }
+  result_type scale() const noexcept { return p_.scale(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return p_.scale(); }
+  result_type max() const noexcept { return std::numeric_limits<Real>::max(); }
+
+  /// @}
+
+  friend bool operator==(const pareto_distribution &lhs, const pareto_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const pareto_distribution &lhs, const pareto_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const pareto_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<Real>::max_digits10);
+    os << d.shape() << os.widen(' ') << d.scale();
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       pareto_distribution &d)
+  {
+    Real shape, scale;
+    if (is >> shape >> scale) d.param(param_type{shape, scale});
+    return is;
+  }
+
+private:
+  struct transform {
+    Real operator()(const double z) const
+    {
+      return p.scale_ * static_cast<Real>(std::exp(z * p.inv_shape_));
+    }
+    const param_type &p;
+  };
+
+  param_type p_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_pareto_distribution_hpp
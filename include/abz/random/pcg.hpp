@@ -0,0 +1,237 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_pcg_hpp
+#define abz_random_pcg_hpp
+
+/// @file abz/random/pcg.hpp
+/// PCG64 engine.
+///
+/// @reference M. E. O'Neill. PCG: A family of simple fast space-efficient statistically good
+/// algorithms for random number generation. HMC-CS-2014-0905.
+/// @reference http://www.pcg-random.org/
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Minimal unsigned 128-bit arithmetic for the PCG state.
+struct uint128 {
+  std::uint64_t hi;
+  std::uint64_t lo;
+
+  friend uint128 operator+(const uint128 &a, const uint128 &b) noexcept
+  {
+    const std::uint64_t lo = a.lo + b.lo;
+    return uint128{a.hi + b.hi + (lo < a.lo ? 1 : 0), lo};
+  }
+
+  friend uint128 operator*(const uint128 &a, const uint128 &b) noexcept
+  {
+    std::uint64_t lo;
+    const std::uint64_t hi = mulhilo(a.lo, b.lo, lo);
+    return uint128{hi + a.hi * b.lo + a.lo * b.hi, lo};
+  }
+
+  friend bool operator==(const uint128 &a, const uint128 &b) noexcept
+  {
+    return a.hi == b.hi && a.lo == b.lo;
+  }
+};
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @class pcg64
+/// @brief The PCG64 engine (128-bit LCG state with the XSL-RR output function).
+///
+/// Satisfies the RandomNumberEngine concept. Outputs are identical to the reference
+/// implementation's <tt>pcg64</tt> (<tt>pcg_setseq_128_xsl_rr_64</tt>). The period is
+/// \f$2^{128}\f$. The engine has \f$2^{127}\f$ streams: a seed sequence selects any of them, a
+/// 64-bit @p stream argument the first \f$2^{64}\f$ ones.
+///
+/// discard() runs in \f$O(\log z)\f$. jump() and long_jump() advance the engine by respectively
+/// \f$2^{64}\f$ and \f$2^{96}\f$ notches.
+class pcg64 {
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = std::uint64_t; ///< The integer type generated.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr result_type default_seed = 0xCAFEF00DD15EA5E5u;
+
+  /// @}
+
+  /// @name Construction and seeding
+  /// @{
+
+  pcg64() : pcg64(default_seed) {}
+
+  /// Constructs the engine on the default stream with the initial state @p value.
+  explicit pcg64(const result_type value) { seed(value); }
+
+  /// Constructs the engine on the stream @p stream, one of the first \f$2^{64}\f$ streams, with the
+  /// initial state @p value.
+  pcg64(const result_type value, const result_type stream) { seed(value, stream); }
+
+  /// Constructs the engine with a state and stream generated from a seed sequence.
+  template <class Sseq,
+            class = typename std::enable_if<!std::is_convertible<Sseq, result_type>::value
+                                            && !std::is_same<Sseq, pcg64>::value>::type>
+  explicit pcg64(Sseq &seq)
+  {
+    seed(seq);
+  }
+
+  /// Reinitializes the engine on the default stream with the initial state @p value.
+  void seed(const result_type value = default_seed)
+  {
+    inc_ = default_increment();
+    reset(_::uint128{0, value});
+  }
+
+  /// Reinitializes the engine on the stream @p stream, one of the first \f$2^{64}\f$ streams,
+  /// with the initial state @p value.
+  void seed(const result_type value, const result_type stream)
+  {
+    inc_ = _::uint128{stream >> 63, (stream << 1) | 1u};
+    reset(_::uint128{0, value});
+  }
+
+  /// Reinitializes the engine with a state and stream generated from a seed sequence.
+  template <class Sseq>
+  typename std::enable_if<!std::is_convertible<Sseq, result_type>::value>::type seed(Sseq &seq)
+  {
+    const auto w = _::generate_words<4>(seq);
+    inc_ = _::uint128{(w[2] << 1) | (w[3] >> 63), (w[3] << 1) | 1u};
+    reset(_::uint128{w[0], w[1]});
+  }
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  /// Advances the engine's state and returns the generated value.
+  result_type operator()() noexcept
+  {
+    state_ = state_ * multiplier() + inc_;
+    const std::uint64_t x = state_.hi ^ state_.lo;
+    const unsigned r = static_cast<unsigned>(state_.hi >> 58);
+    return (x >> r) | (x << ((64 - r) & 63));
+  }
+
+  /// Advances the engine's state by @p z notches in logarithmic time.
+  void discard(const unsigned long long z) noexcept { advance(_::uint128{0, z}); }
+
+  /// Advances the engine's state by \f$2^{64}\f$ notches.
+  void jump() noexcept { advance(_::uint128{1, 0}); }
+
+  /// Advances the engine's state by \f$2^{96}\f$ notches.
+  void long_jump() noexcept { advance(_::uint128{std::uint64_t{1} << 32, 0}); }
+
+  /// @}
+
+  friend bool operator==(const pcg64 &lhs, const pcg64 &rhs)
+  {
+    return lhs.state_ == rhs.state_ && lhs.inc_ == rhs.inc_;
+  }
+
+  friend bool operator!=(const pcg64 &lhs, const pcg64 &rhs) { return !(lhs == rhs); }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const pcg64 &e)
+  {
+    const auto space = os.widen(' ');
+    return os << e.state_.hi << space << e.state_.lo << space << e.inc_.hi << space << e.inc_.lo;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       pcg64 &e)
+  {
+    _::uint128 state, inc;
+    if (is >> state.hi >> state.lo >> inc.hi >> inc.lo) {
+      e.state_ = state;
+      e.inc_ = inc;
+    }
+    return is;
+  }
+
+private:
+  static _::uint128 multiplier() noexcept
+  {
+    return _::uint128{0x2360ED051FC65DA4u, 0x4385DF649FCCF645u};
+  }
+
+  static _::uint128 default_increment() noexcept
+  {
+    return _::uint128{0x5851F42D4C957F2Du, 0x14057B7EF767814Fu};
+  }
+
+  void reset(const _::uint128 &value) noexcept
+  {
+    state_ = _::uint128{0, 0};
+    (*this)();
+    state_ = state_ + value;
+    (*this)();
+  }
+
+  // F. Brown. Random number generation with arbitrary strides. 1994.
+  void advance(_::uint128 delta) noexcept
+  {
+    _::uint128 acc_mult{0, 1}, acc_plus{0, 0};
+    _::uint128 cur_mult = multiplier(), cur_plus = inc_;
+    while ((delta.hi | delta.lo) != 0) {
+      if (delta.lo & 1u) {
+        acc_mult = acc_mult * cur_mult;
+        acc_plus = acc_plus * cur_mult + cur_plus;
+      }
+      cur_plus = (cur_mult + _::uint128{0, 1}) * cur_plus;
+      cur_mult = cur_mult * cur_mult;
+      delta = _::uint128{delta.hi >> 1, (delta.lo >> 1) | (delta.hi << 63)};
+    }
+    state_ = acc_mult * state_ + acc_plus;
+  }
+
+  _::uint128 state_;
+  _::uint128 inc_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_pcg_hpp
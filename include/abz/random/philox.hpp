@@ -0,0 +1,101 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_philox_hpp
+#define abz_random_philox_hpp
+
+/// @file abz/random/philox.hpp
+/// Philox counter-based engines.
+///
+/// @reference J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw. Parallel random numbers: as easy
+/// as 1, 2, 3. SC'11.
+/// @reference https://github.com/DEShawResearch/random123
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/counter_based_engine.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+ABZ_NAMESPACE_BEGIN
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+template <class UIntType>
+struct philox_constants;
+
+template <>
+struct philox_constants<std::uint32_t> {
+  static constexpr std::uint32_t m0 = 0xD2511F53u;
+  static constexpr std::uint32_t m1 = 0xCD9E8D57u;
+  static constexpr std::uint32_t w0 = 0x9E3779B9u;
+  static constexpr std::uint32_t w1 = 0xBB67AE85u;
+};
+
+template <>
+struct philox_constants<std::uint64_t> {
+  static constexpr std::uint64_t m0 = 0xD2E7470EE14C6C93u;
+  static constexpr std::uint64_t m1 = 0xCA5A826395121157u;
+  static constexpr std::uint64_t w0 = 0x9E3779B97F4A7C15u;
+  static constexpr std::uint64_t w1 = 0xBB67AE8584CAA73Bu;
+};
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @class philox
+/// @brief The Philox4xW keyed bijection.
+///
+/// @tparam UIntType The word type (<tt>std::uint32_t</tt> or <tt>std::uint64_t</tt>).
+/// @tparam Rounds The number of rounds (10 is the recommended value).
+template <class UIntType, std::size_t Rounds = 10>
+struct philox {
+  using result_type = UIntType;
+  using counter_type = std::array<UIntType, 4>;
+  using key_type = std::array<UIntType, 2>;
+
+  /// Returns the image of @p ctr by the bijection keyed with @p key.
+  static counter_type apply(counter_type ctr, key_type key) noexcept
+  {
+    using c = _::philox_constants<UIntType>;
+    for (std::size_t r = 0; r < Rounds; ++r) {
+      if (r != 0) {
+        key[0] = static_cast<UIntType>(key[0] + c::w0);
+        key[1] = static_cast<UIntType>(key[1] + c::w1);
+      }
+      UIntType lo0, lo1;
+      const UIntType hi0 = _::mulhilo(c::m0, ctr[0], lo0);
+      const UIntType hi1 = _::mulhilo(c::m1, ctr[2], lo1);
+      ctr = {{static_cast<UIntType>(hi1 ^ ctr[1] ^ key[0]), lo1,
+              static_cast<UIntType>(hi0 ^ ctr[3] ^ key[1]), lo0}};
+    }
+    return ctr;
+  }
+};
+
+/// Philox engine with four 32-bit words and 10 rounds.
+using philox4x32 = counter_based_engine<philox<std::uint32_t>>;
+
+/// Philox engine with four 64-bit words and 10 rounds.
+using philox4x64 = counter_based_engine<philox<std::uint64_t>>;
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_philox_hpp
@@ -0,0 +1,252 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_poisson_distribution_hpp
+#define abz_random_poisson_distribution_hpp
+
+/// @file abz/random/poisson_distribution.hpp
+/// Poisson distribution sampled with the PTRS method.
+///
+/// @reference W. Hörmann. The transformed rejection method for generating Poisson random
+/// variables. Insurance: Mathematics and Economics, 1993.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/discrete.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class poisson_distribution
+/// @brief Poisson distribution sampled with the PTRS method.
+///
+/// Satisfies the RandomNumberDistribution concept and can replace
+/// <tt>std::poisson_distribution</tt>. Means of at least 10 are sampled with Hörmann's transformed
+/// rejection with squeeze (PTRS): two uniforms, a multiplication and a division per try, with
+/// about 1.1 tries per value whatever the mean, and a logarithm for the few values the squeeze
+/// does not accept. Smaller means are sampled by inversion, with a single uniform.
+///
+/// The constants of both methods are computed when the parameters are built: keep the param_type
+/// (or the distribution) around when drawing many values of the same mean. generate() fills whole
+/// ranges at once with words drawn in bulk.
+///
+/// @code
+/// using Poisson = abz::random::poisson_distribution<>;
+/// const Poisson::param_type arrivals{rate * dt};
+/// for (auto &cell : cells) cell.events += abz::rand<Poisson>(arrivals);
+/// @endcode
+///
+/// @tparam IntType An integral type.
+template <class IntType = int>
+class poisson_distribution {
+  static_assert(std::is_integral<IntType>::value, "IntType must be an integral type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = IntType; ///< The integral type generated.
+
+  /// The parameters of the distribution.
+  class param_type {
+  public:
+    using distribution_type = poisson_distribution;
+
+    explicit param_type(const double mean = 1.) : mean_(mean)
+    {
+      if (mean_ < ptrs_threshold) {
+        exp_neg_mean_ = std::exp(-mean_);
+        return;
+      }
+      const double smu = std::sqrt(mean_);
+      log_mean_ = std::log(mean_);
+      b_ = 0.931 + 2.53 * smu;
+      a_ = -0.059 + 0.02483 * b_;
+      inv_alpha_ = 1.1239 + 1.1328 / (b_ - 3.4);
+      vr_ = 0.9277 - 3.6224 / (b_ - 2);
+    }
+
+    double mean() const noexcept { return mean_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.mean_ == rhs.mean_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class poisson_distribution;
+
+    double mean_;
+    double exp_neg_mean_ = 0.; // Inversion.
+    double log_mean_ = 0.;     // PTRS.
+    double a_ = 0.;
+    double b_ = 0.;
+    double inv_alpha_ = 0.;
+    double vr_ = 0.;
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  poisson_distribution() : poisson_distribution(1.) {}
+
+  explicit poisson_distribution(const double mean) : p_(mean) {}
+
+  explicit poisson_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return sample(g, p);
+  }
+
+  /// Fills \f$[first, last)\f$ with Poisson distributed values.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values following the distribution of parameters @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    _::generate_buffered(first, last, g,
+                         [&p](_::word_buffer<Engine> &w) { return sample(w, p); });
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  double mean() const noexcept { return p_.mean(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return 0; }
+  result_type max() const noexcept { return std::numeric_limits<result_type>::max(); }
+
+  /// @}
+
+  friend bool operator==(const poisson_distribution &lhs, const poisson_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const poisson_distribution &lhs, const poisson_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const poisson_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+    os << d.mean();
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       poisson_distribution &d)
+  {
+    double mean;
+    if (is >> mean) d.param(param_type{mean});
+    return is;
+  }
+
+private:
+  /// The smallest mean sampled with PTRS.
+  static constexpr double ptrs_threshold = 10.;
+
+  template <class Engine>
+  static result_type sample(Engine &g, const param_type &p)
+  {
+    return p.mean_ < ptrs_threshold ? inversion(g, p) : ptrs(g, p);
+  }
+
+  /// Sequential search of the inverse of the distribution function.
+  template <class Engine>
+  static result_type inversion(Engine &g, const param_type &p)
+  {
+    for (;;) {
+      double u = _::unit_open(g), f = p.exp_neg_mean_;
+      for (result_type k = 0; f != 0.; f *= p.mean_ / ++k) {
+        if (u <= f) return k;
+        u -= f;
+      }
+      // The rounding errors left u beyond the distribution function: draw again.
+    }
+  }
+
+  template <class Engine>
+  static result_type ptrs(Engine &g, const param_type &p)
+  {
+    constexpr double max = static_cast<double>(std::numeric_limits<result_type>::max());
+    for (;;) {
+      const double u = _::unit_open(g) - .5, v = _::unit_open(g);
+      const double us = .5 - std::fabs(u);
+      const double k = std::floor((2 * p.a_ / us + p.b_) * u + p.mean_ + .43);
+      if (k < 0 || k > max) continue;
+      if (us >= .07 && v <= p.vr_) return static_cast<result_type>(k);
+      if (us < .013 && v > us) continue;
+      if (std::log(v * p.inv_alpha_ / (p.a_ / (us * us) + p.b_))
+          <= k * p.log_mean_ - p.mean_ - _::log_factorial(k)) {
+        return static_cast<result_type>(k);
+      }
+    }
+  }
+
+  param_type p_;
+};
+
+template <class IntType>
+constexpr double poisson_distribution<IntType>::ptrs_threshold;
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_poisson_distribution_hpp
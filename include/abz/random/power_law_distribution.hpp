@@ -0,0 +1,221 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_power_law_distribution_hpp
+#define abz_random_power_law_distribution_hpp
+
+/// @file abz/random/power_law_distribution.hpp
+/// Power law distribution bounded to an interval, sampled by inversion.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/discrete.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class power_law_distribution
+/// @brief Power law distribution bounded to an interval, sampled by inversion.
+///
+/// Satisfies the RandomNumberDistribution concept. Values are on \f$[a, b]\f$, \f$0 < a < b\f$,
+/// with a density proportional to \f$x^{-\gamma}\f$ for any real exponent \f$\gamma\f$: a Pareto
+/// distribution truncated at \f$b\f$ when \f$\gamma > 1\f$, the log-uniform distribution when
+/// \f$\gamma = 1\f$.
+///
+/// The distribution function is inverted in closed form,
+/// \f$x = a \left(1 + u \left((b/a)^{1 - \gamma} - 1\right)\right)^{1 / (1 - \gamma)}\f$, with
+/// its constants computed when the parameters are built: a value costs a uniform, a logarithm
+/// and an exponential. generate() fills whole ranges at once with words drawn in bulk.
+///
+/// @tparam Real A floating point type.
+template <class Real = double>
+class power_law_distribution {
+  static_assert(std::is_floating_point<Real>::value, "Real must be a floating point type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = Real; ///< The floating point type generated.
+
+  /// The parameters of the distribution.
+  class param_type {
+  public:
+    using distribution_type = power_law_distribution;
+
+    explicit param_type(const Real exponent = Real{2},
+                        const Real a = Real{1},
+                        const Real b = Real{2})
+      : exponent_(exponent)
+      , a_(a)
+      , b_(b)
+    {
+      const double log_ratio = std::log(static_cast<double>(b) / static_cast<double>(a));
+      const double e = 1. - static_cast<double>(exponent);
+      if (e == 0.) {
+        log_ratio_ = log_ratio;
+      } else {
+        ratio_ = std::expm1(e * log_ratio);
+        inv_e_ = 1. / e;
+      }
+    }
+
+    Real exponent() const noexcept { return exponent_; }
+    Real a() const noexcept { return a_; }
+    Real b() const noexcept { return b_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.exponent_ == rhs.exponent_ && lhs.a_ == rhs.a_ && lhs.b_ == rhs.b_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class power_law_distribution;
+
+    Real exponent_;
+    Real a_;
+    Real b_;
+    double ratio_ = 0.;     // (b / a)^(1 - exponent) - 1.
+    double inv_e_ = 0.;     // 1 / (1 - exponent).
+    double log_ratio_ = 0.; // log(b / a), when the exponent is 1.
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  power_law_distribution() : power_law_distribution(Real{2}) {}
+
+  explicit power_law_distribution(const Real exponent,
+                                  const Real a = Real{1},
+                                  const Real b = Real{2})
+    : p_(exponent, a, b)
+  {
+  }
+
+  explicit power_law_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return sample(g, p);
+  }
+
+  /// Fills \f$[first, last)\f$ with values following the power law.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values following the distribution of parameters @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    _::generate_buffered(first, last, g,
+                         [&p](_::word_buffer<Engine> &w) { return sample(w, p); });
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  result_type exponent() const noexcept { return p_.exponent(); }
+  result_type a() const noexcept { return p_.a(); }
+  result_type b() const noexcept { return p_.b(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return p_.a(); }
+  result_type max() const noexcept { return p_.b(); }
+
+  /// @}
+
+  friend bool operator==(const power_law_distribution &lhs, const power_law_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const power_law_distribution &lhs, const power_law_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const power_law_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<Real>::max_digits10);
+    const CharT space = os.widen(' ');
+    os << d.exponent() << space << d.a() << space << d.b();
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       power_law_distribution &d)
+  {
+    Real exponent, a, b;
+    if (is >> exponent >> a >> b) d.param(param_type{exponent, a, b});
+    return is;
+  }
+
+private:
+  template <class Engine>
+  static result_type sample(Engine &g, const param_type &p)
+  {
+    const double u = _::unit_open(g);
+    const double y = p.inv_e_ != 0. ? std::log1p(u * p.ratio_) * p.inv_e_ : u * p.log_ratio_;
+    const Real x = p.a_ * static_cast<Real>(std::exp(y));
+    // The rounding errors must not leave the interval.
+    return x < p.b_ ? x : p.b_;
+  }
+
+  param_type p_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_power_law_distribution_hpp
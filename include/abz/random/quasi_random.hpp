@@ -0,0 +1,633 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_quasi_random_hpp
+#define abz_random_quasi_random_hpp
+
+/// @file abz/random/quasi_random.hpp
+/// Low-discrepancy sequences of points of the unit hypercube.
+///
+/// The points of a quasi-random sequence cover \f$[0, 1)^d\f$ much more evenly than random points,
+/// so the error of a Monte Carlo integration decreases about as \f$1/n\f$ instead of
+/// \f$1/\sqrt{n}\f$. Each sequence writes its points coordinate after coordinate, and whole blocks
+/// of points at once with their generate_n() member or with @ref abz::random::fill.
+///
+/// @reference I. M. Sobol. On the distribution of points in a cube and the approximate evaluation
+/// of integrals. USSR Computational Mathematics and Mathematical Physics, 1967.
+/// @reference S. Joe, F. Y. Kuo. Constructing Sobol sequences with better two-dimensional
+/// projections. SIAM Journal on Scientific Computing, 2008.
+/// @reference B. Burley. Practical hash-based Owen scrambling. Journal of Computer Graphics
+/// Techniques, 2020.
+/// @reference J. Matoušek. On the L2-discrepancy for anchored boxes. Journal of Complexity, 1998.
+/// @reference M. Roberts. The unreasonable effectiveness of quasirandom sequences, 2018.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+#include "abz/random/detail/simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Converts a 32-bit fraction to a value of \f$[0, 1)\f$.
+template <class Real>
+inline Real unit_fraction(const std::uint32_t x) noexcept;
+
+template <>
+inline double unit_fraction<double>(const std::uint32_t x) noexcept
+{
+  return fraction32(x);
+}
+
+template <>
+inline float unit_fraction<float>(const std::uint32_t x) noexcept
+{
+  return static_cast<float>(x >> 8) * (1.f / 16777216.f);
+}
+
+/// Converts a 64-bit fraction to a value of \f$[0, 1)\f$.
+template <class Real>
+inline Real unit_fraction(const std::uint64_t x) noexcept;
+
+template <>
+inline double unit_fraction<double>(const std::uint64_t x) noexcept
+{
+  return static_cast<double>(x >> 11) * (1. / 9007199254740992.);
+}
+
+template <>
+inline float unit_fraction<float>(const std::uint64_t x) noexcept
+{
+  return static_cast<float>(x >> 40) * (1.f / 16777216.f);
+}
+
+/// Product of the polynomials of \f$GF(2)[x]\f$ @p a and @p b modulo @p p of degree @p degree.
+inline std::uint64_t gf2_mulmod(std::uint64_t a,
+                                std::uint64_t b,
+                                const std::uint64_t p,
+                                const unsigned degree) noexcept
+{
+  std::uint64_t r = 0;
+  for (; b != 0; b >>= 1) {
+    if (b & 1u) r ^= a;
+    a <<= 1;
+    if ((a >> degree) & 1u) a ^= p;
+  }
+  return r;
+}
+
+/// \f$x^e\f$ modulo @p p of degree @p degree.
+inline std::uint64_t gf2_powmod_x(std::uint64_t e,
+                                  const std::uint64_t p,
+                                  const unsigned degree) noexcept
+{
+  std::uint64_t r = 1, x = degree == 1 ? (2u ^ p) : 2u;
+  for (; e != 0; e >>= 1) {
+    if (e & 1u) r = gf2_mulmod(r, x, p, degree);
+    x = gf2_mulmod(x, x, p, degree);
+  }
+  return r;
+}
+
+/// Primitive polynomials of \f$GF(2)[x]\f$ by increasing degree, the degree 1 one (\f$x + 1\f$)
+/// first. Bit \f$i\f$ of a polynomial is its coefficient of \f$x^i\f$.
+class primitive_polynomials {
+public:
+  /// Returns the next primitive polynomial, setting @p degree.
+  std::uint64_t next(unsigned &degree)
+  {
+    for (;;) {
+      if (candidate_ >> degree_ != 1) start(degree_ + 1);
+      const std::uint64_t p = candidate_;
+      candidate_ += 2;
+      if (is_primitive(p)) {
+        degree = degree_;
+        return p;
+      }
+    }
+  }
+
+private:
+  void start(const unsigned degree)
+  {
+    degree_ = degree;
+    candidate_ = (std::uint64_t{1} << degree) | 1u;
+    // Prime factors of the order of the multiplicative group.
+    factors_.clear();
+    std::uint64_t n = (std::uint64_t{1} << degree) - 1;
+    for (std::uint64_t q = 2; q * q <= n; ++q) {
+      if (n % q != 0) continue;
+      factors_.push_back(q);
+      while (n % q == 0) n /= q;
+    }
+    if (n > 1) factors_.push_back(n);
+  }
+
+  /// The polynomial is primitive when \f$x\f$ has order \f$2^{degree} - 1\f$ modulo it.
+  bool is_primitive(const std::uint64_t p) const noexcept
+  {
+    const std::uint64_t order = (std::uint64_t{1} << degree_) - 1;
+    if (gf2_powmod_x(order, p, degree_) != 1) return false;
+    for (const std::uint64_t q : factors_) {
+      if (gf2_powmod_x(order / q, p, degree_) == 1) return false;
+    }
+    return true;
+  }
+
+  unsigned degree_ = 0;
+  std::uint64_t candidate_ = 2;
+  std::vector<std::uint64_t> factors_;
+};
+
+/// Fills the 32 direction numbers of a dimension, bit-major in @p v with a stride of @p stride,
+/// from its primitive polynomial and its initial numbers @p m (odd, \f$m_i < 2^i\f$).
+inline void sobol_directions(const std::uint64_t polynomial,
+                             const unsigned degree,
+                             std::vector<std::uint32_t> m,
+                             std::uint32_t *v,
+                             const std::size_t stride)
+{
+  m.resize(32);
+  for (unsigned i = degree; i < 32; ++i) {
+    std::uint32_t x = m[i - degree] ^ (m[i - degree] << degree);
+    for (unsigned k = 1; k < degree; ++k) {
+      if ((polynomial >> (degree - k)) & 1u) x ^= m[i - k] << k;
+    }
+    m[i] = x;
+  }
+  for (unsigned i = 0; i < 32; ++i) v[i * stride] = m[i] << (31 - i);
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @class sobol_sequence
+/// @brief The Sobol sequence, optionally Owen-scrambled.
+///
+/// Point \f$n\f$ is built in Gray code order: it differs from point \f$n - 1\f$ by a single
+/// direction number per coordinate, so a new point costs one XOR per dimension, and seek() jumps
+/// to any index in \f$O(32 d)\f$. Up to \f$2^{32}\f$ points are generated, with 32 bits per
+/// coordinate: the sequence then stops, see max_points. Blocks of points of doubles are written by
+/// vectorized kernels.
+///
+/// The direction numbers are derived from the primitive polynomials of \f$GF(2)\f$ taken by
+/// increasing degree, with initial numbers drawn from a fixed hash: any number of dimensions is
+/// available. The tables of Joe and Kuo, whose two-dimensional projections are better, can be
+/// loaded from their published files (for example @c new-joe-kuo-6.21201).
+///
+/// The scrambled sequences apply a hash-based nested uniform (Owen) scrambling to each coordinate,
+/// which keeps the low discrepancy of the points while making them random, so that independent
+/// seeds give independent error estimates.
+///
+/// @code
+/// abz::random::sobol_sequence sobol{dimensions, seed};
+/// std::vector<double> points(n * dimensions);
+/// sobol.generate_n(points.data(), n); // n points, one after another
+/// @endcode
+class sobol_sequence {
+public:
+  /// The maximum number of points. Once they have all been generated, index() is max_points and
+  /// the sequence writes no more points.
+  static constexpr std::uint64_t max_points = std::uint64_t{1} << 32;
+
+  /// Sequence of @p dimensions dimensions with generated direction numbers.
+  explicit sobol_sequence(const std::size_t dimensions) : sobol_sequence(dimensions, nullptr) {}
+
+  /// Owen-scrambled sequence of @p dimensions dimensions.
+  sobol_sequence(const std::size_t dimensions, const std::uint64_t seed)
+    : sobol_sequence(dimensions)
+  {
+    scramble(seed);
+  }
+
+  /// Sequence of @p dimensions dimensions with the direction numbers read from @p joe_kuo, in the
+  /// format of the files of Joe and Kuo: a header line, then one line <tt>d s a m_1 ... m_s</tt>
+  /// per dimension from the second one. Dimensions missing from the file get generated numbers.
+  sobol_sequence(const std::size_t dimensions, std::istream &joe_kuo)
+    : sobol_sequence(dimensions, &joe_kuo)
+  {
+  }
+
+  /// Replaces the scrambling of the sequence by the one derived from @p seed.
+  void scramble(const std::uint64_t seed)
+  {
+    if (seeds_.empty()) reverse();
+    seeds_.resize(dimensions_);
+    for (std::size_t d = 0; d < dimensions_; ++d) {
+      seeds_[d] = static_cast<std::uint32_t>(_::substream_seed(seed, d));
+    }
+  }
+
+  /// Removes the scrambling of the sequence.
+  void unscramble()
+  {
+    if (!seeds_.empty()) reverse();
+    seeds_.clear();
+  }
+
+  /// Returns the number of dimensions.
+  std::size_t dimensions() const noexcept { return dimensions_; }
+
+  /// Returns the index of the next point.
+  std::uint64_t index() const noexcept { return index_; }
+
+  /// Moves to point @p index, or to the end of the sequence if @p index is not less than
+  /// max_points.
+  void seek(const std::uint64_t index)
+  {
+    if (index >= max_points) {
+      index_ = max_points;
+      return;
+    }
+    std::fill(x_.begin(), x_.end(), 0u);
+    const std::uint64_t gray = index ^ (index >> 1);
+    for (unsigned bit = 0; bit < 32; ++bit) {
+      if (((gray >> bit) & 1u) == 0) continue;
+      const std::uint32_t *v = &directions_[bit * dimensions_];
+      for (std::size_t d = 0; d < dimensions_; ++d) x_[d] ^= v[d];
+    }
+    index_ = index;
+  }
+
+  /// Skips @p z points.
+  void discard(const std::uint64_t z) { seek(z < max_points - index_ ? index_ + z : max_points); }
+
+  /// Writes the coordinates of the next point to @p out, and returns the end of the point. Returns
+  /// @p out and writes nothing at the end of the sequence.
+  template <class Real>
+  Real *next(Real *out)
+  {
+    static_assert(std::is_same<Real, float>::value || std::is_same<Real, double>::value,
+                  "Only float and double are supported");
+    if (index_ == max_points) return out;
+    const std::size_t n = dimensions_;
+    std::uint32_t *x = x_.data();
+    if (seeds_.empty()) {
+      for (std::size_t d = 0; d < n; ++d) out[d] = _::unit_fraction<Real>(x[d]);
+    } else {
+      const std::uint32_t *seeds = seeds_.data();
+      for (std::size_t d = 0; d < n; ++d) {
+        out[d] = _::unit_fraction<Real>(
+          _::reverse_bits(_::laine_karras_permutation(x[d], seeds[d])));
+      }
+    }
+    // The last point has no successor: its index has no lowest bit below 32.
+    if (++index_ == max_points) return out + n;
+    const std::uint32_t *v = &directions_[_::lowest_bit(index_) * n];
+    for (std::size_t d = 0; d < n; ++d) x[d] ^= v[d];
+    return out + n;
+  }
+
+  /// Writes the next @p points points to @p out, one after another, and returns the end of the
+  /// last one. Stops at the end of the sequence.
+  template <class Real>
+  Real *generate_n(Real *out, std::size_t points)
+  {
+    for (; points != 0 && index_ != max_points; --points) out = next(out);
+    return out;
+  }
+
+  /// Writes the next @p points points to @p out, one after another, with the vectorized kernels
+  /// (scrambled included from AVX2 on), and returns the end of the last one. Stops at the end of
+  /// the sequence.
+  double *generate_n(double *out, std::size_t points)
+  {
+    const std::uint64_t remaining = max_points - index_;
+    const bool last = points >= remaining;
+    // The kernels move to the successor of each point: the last point is written by next().
+    if (last) points = static_cast<std::size_t>(remaining - (remaining != 0 ? 1 : 0));
+    _::sobol_state s{x_.data(), directions_.data(), seeds_.empty() ? nullptr : seeds_.data(),
+                     dimensions_, index_};
+    _::sobol(_::simd_isa_in_use(), s, out, points);
+    index_ = s.index;
+    out += points * dimensions_;
+    return last ? next(out) : out;
+  }
+
+private:
+  /// Reverses the bits of the direction numbers and of the current point, which the scrambling
+  /// works on.
+  void reverse()
+  {
+    for (std::uint32_t &v : directions_) v = _::reverse_bits(v);
+    for (std::uint32_t &x : x_) x = _::reverse_bits(x);
+  }
+
+  sobol_sequence(const std::size_t dimensions, std::istream *joe_kuo)
+    : dimensions_(std::max<std::size_t>(dimensions, 1))
+    , directions_(32 * dimensions_)
+    , x_(dimensions_)
+  {
+    // The first dimension is the van der Corput sequence.
+    for (unsigned i = 0; i < 32; ++i) directions_[i * dimensions_] = std::uint32_t{1} << (31 - i);
+
+    std::size_t d = 1;
+    if (joe_kuo != nullptr) {
+      std::string line;
+      std::getline(*joe_kuo, line);
+      for (; d < dimensions_ && std::getline(*joe_kuo, line); ++d) {
+        std::istringstream row{line};
+        unsigned index, degree;
+        std::uint64_t a;
+        if (!(row >> index >> degree >> a) || degree == 0 || degree > 31) break;
+        std::vector<std::uint32_t> m(degree);
+        for (std::uint32_t &mi : m) row >> mi;
+        if (!row) break;
+        _::sobol_directions((std::uint64_t{1} << degree) | (a << 1) | 1u, degree, m,
+                            &directions_[d], dimensions_);
+      }
+    }
+
+    _::primitive_polynomials polynomials;
+    unsigned degree;
+    for (std::size_t k = 1; k < d; ++k) polynomials.next(degree);
+    for (; d < dimensions_; ++d) {
+      const std::uint64_t p = polynomials.next(degree);
+      std::vector<std::uint32_t> m(degree);
+      for (unsigned i = 0; i < degree; ++i) {
+        const std::uint64_t h = _::substream_seed(0x50B01u + d, i);
+        m[i] = static_cast<std::uint32_t>(h & ((std::uint64_t{1} << (i + 1)) - 1)) | 1u;
+      }
+      _::sobol_directions(p, degree, m, &directions_[d], dimensions_);
+    }
+  }
+
+  std::size_t dimensions_;
+  // The direction numbers and the current point have their bits reversed when scrambled.
+  std::vector<std::uint32_t> directions_; // Bit-major: directions_[bit * dimensions_ + d].
+  std::vector<std::uint32_t> x_;          // The current point, before the scrambling.
+  std::vector<std::uint32_t> seeds_;      // Scrambling seeds, empty when not scrambled.
+  std::uint64_t index_ = 0;
+};
+
+/// @class halton_sequence
+/// @brief The Halton sequence, optionally scrambled.
+///
+/// Coordinate \f$k\f$ of point \f$n\f$ is the radical inverse of \f$n\f$ in the \f$k\f$-th prime
+/// base. The scrambled sequences apply a random linear scrambling to the digits (Matoušek), each
+/// digit position of each dimension getting its own permutation \f$x \mapsto a x + b \bmod p\f$,
+/// which breaks the correlations between the dimensions of large prime bases.
+///
+/// The sequence keeps the digits of the index of the next point in each base, and the coordinates
+/// in 64-bit fixed point. Incrementing the index changes a single digit most of the time, so a
+/// coordinate costs an addition and no division, except when seek() decomposes a new index.
+class halton_sequence {
+public:
+  /// Sequence of @p dimensions dimensions.
+  explicit halton_sequence(const std::size_t dimensions)
+    : dimensions_(std::max<std::size_t>(dimensions, 1))
+    , weights_(dimensions_)
+    , digits_(dimensions_)
+    , x_(dimensions_)
+  {
+    std::uint32_t p = 2;
+    for (std::size_t d = 0; d < dimensions_; ++p) {
+      bool prime = true;
+      for (std::size_t k = 0; k < d && bases_[k] * bases_[k] <= p; ++k) {
+        if (p % bases_[k] == 0) {
+          prime = false;
+          break;
+        }
+      }
+      if (!prime) continue;
+      bases_.push_back(p);
+      // floor(2^64 / p^(j + 1)), enough of them for the digits of a 64-bit index.
+      std::uint64_t w = std::numeric_limits<std::uint64_t>::max() / p + (p == 2);
+      for (; weights_[d].size() < 64; w /= p) weights_[d].push_back(w);
+      ++d;
+    }
+  }
+
+  /// Scrambled sequence of @p dimensions dimensions.
+  halton_sequence(const std::size_t dimensions, const std::uint64_t seed)
+    : halton_sequence(dimensions)
+  {
+    scramble(seed);
+  }
+
+  /// Replaces the scrambling of the sequence by the one derived from @p seed.
+  void scramble(const std::uint64_t seed)
+  {
+    permutations_.assign(dimensions_, {});
+    for (std::size_t d = 0; d < dimensions_; ++d) {
+      const std::uint32_t b = bases_[d];
+      // Enough digits for the precision of a double.
+      const unsigned digits = static_cast<unsigned>(std::ceil(53. / std::log2(b)));
+      std::uint64_t s = _::substream_seed(seed, d);
+      for (unsigned j = 0; j < digits; ++j) {
+        const std::uint64_t h = _::splitmix64_next(s);
+        permutations_[d].push_back({static_cast<std::uint32_t>(1 + (h >> 32) % (b - 1)),
+                                    static_cast<std::uint32_t>((h & 0xFFFFFFFFu) % b)});
+      }
+    }
+    seek(index_);
+  }
+
+  /// Removes the scrambling of the sequence.
+  void unscramble()
+  {
+    permutations_.clear();
+    seek(index_);
+  }
+
+  std::size_t dimensions() const noexcept { return dimensions_; }
+  std::uint64_t index() const noexcept { return index_; }
+
+  /// Moves to point @p index.
+  void seek(const std::uint64_t index)
+  {
+    for (std::size_t d = 0; d < dimensions_; ++d) {
+      digits_[d].clear();
+      x_[d] = 0;
+      // The null digits are permuted too, up to the precision of a double.
+      const std::size_t permuted = permutations_.empty() ? 0 : permutations_[d].size();
+      std::uint64_t n = index;
+      for (std::size_t j = 0; n != 0 || j < permuted; ++j, n /= bases_[d]) {
+        digits_[d].push_back({0, 0});
+        set_digit(d, j, static_cast<std::uint32_t>(n % bases_[d]));
+      }
+    }
+    index_ = index;
+  }
+
+  /// Skips @p z points.
+  void discard(const std::uint64_t z) { seek(index_ + z); }
+
+  /// Writes the coordinates of the next point to @p out.
+  template <class Real>
+  Real *next(Real *out)
+  {
+    static_assert(std::is_same<Real, float>::value || std::is_same<Real, double>::value,
+                  "Only float and double are supported");
+    for (std::size_t d = 0; d < dimensions_; ++d) {
+      out[d] = _::unit_fraction<Real>(x_[d]);
+      std::vector<digit> &digits = digits_[d];
+      std::size_t j = 0;
+      for (; j != digits.size() && digits[j].value + 1 == bases_[d]; ++j) set_digit(d, j, 0);
+      if (j == digits.size()) digits.push_back({0, 0});
+      set_digit(d, j, digits[j].value + 1);
+    }
+    ++index_;
+    return out + dimensions_;
+  }
+
+  /// Writes the next @p points points to @p out, one after another.
+  template <class Real>
+  Real *generate_n(Real *out, std::size_t points)
+  {
+    for (; points != 0; --points) out = next(out);
+    return out;
+  }
+
+private:
+  struct permutation {
+    std::uint32_t a;
+    std::uint32_t b;
+  };
+
+  /// A digit of the index and its term in the coordinate.
+  struct digit {
+    std::uint32_t value;
+    std::uint64_t term;
+  };
+
+  /// Sets the digit @p j of dimension @p d, updating the coordinate. The fixed point terms are
+  /// integers, so the updates do not accumulate rounding errors.
+  void set_digit(const std::size_t d, const std::size_t j, const std::uint32_t value) noexcept
+  {
+    std::uint64_t permuted = value;
+    if (!permutations_.empty()) {
+      // Digits beyond the precision of a double do not count.
+      const std::vector<permutation> &permutations = permutations_[d];
+      permuted = j < permutations.size()
+                   ? (std::uint64_t{permutations[j].a} * value + permutations[j].b) % bases_[d]
+                   : 0;
+    }
+    digit &g = digits_[d][j];
+    const std::uint64_t term = permuted * weights_[d][j];
+    x_[d] += term - g.term;
+    g = {value, term};
+  }
+
+  std::size_t dimensions_;
+  std::vector<std::uint32_t> bases_;
+  std::vector<std::vector<std::uint64_t>> weights_;    // Of the digits, in fixed point.
+  std::vector<std::vector<permutation>> permutations_; // Empty when not scrambled.
+  std::vector<std::vector<digit>> digits_;             // Of index_, least significant first.
+  std::vector<std::uint64_t> x_;                       // The next point, in fixed point.
+  std::uint64_t index_ = 0;
+};
+
+/// @class r_sequence
+/// @brief Roberts' additive recurrence \f$R_d\f$, optionally randomly shifted.
+///
+/// Point \f$n\f$ is \f$\{s + n \alpha\}\f$, with \f$\alpha_k = \phi_d^{-k}\f$ and \f$\phi_d\f$ the
+/// positive root of \f$x^{d + 1} = x + 1\f$ (the golden ratio for \f$d = 1\f$, the plastic number
+/// for \f$d = 2\f$). The coordinates are computed in 64-bit fixed point, exactly and without
+/// dependency between the points. The scrambled sequences draw the shift \f$s\f$ at random
+/// (Cranley-Patterson rotation), the others use \f$s = 1/2\f$.
+class r_sequence {
+public:
+  /// Sequence of @p dimensions dimensions.
+  explicit r_sequence(const std::size_t dimensions)
+    : dimensions_(std::max<std::size_t>(dimensions, 1))
+    , alpha_(dimensions_)
+    , shift_(dimensions_, std::uint64_t{1} << 63)
+  {
+    long double phi = 2;
+    for (int i = 0; i < 64; ++i) {
+      const long double p = std::pow(phi, static_cast<long double>(dimensions_));
+      phi -= (p * phi - phi - 1) / ((dimensions_ + 1) * p - 1);
+    }
+    long double a = 1;
+    for (std::uint64_t &alpha : alpha_) {
+      a /= phi;
+      alpha = static_cast<std::uint64_t>(std::ldexp(a, 64));
+    }
+  }
+
+  /// Randomly shifted sequence of @p dimensions dimensions.
+  r_sequence(const std::size_t dimensions, const std::uint64_t seed) : r_sequence(dimensions)
+  {
+    scramble(seed);
+  }
+
+  /// Replaces the shift of the sequence by the one derived from @p seed.
+  void scramble(const std::uint64_t seed)
+  {
+    for (std::size_t d = 0; d < dimensions_; ++d) shift_[d] = _::substream_seed(seed, d);
+  }
+
+  /// Restores the shift \f$1/2\f$.
+  void unscramble() { std::fill(shift_.begin(), shift_.end(), std::uint64_t{1} << 63); }
+
+  std::size_t dimensions() const noexcept { return dimensions_; }
+  std::uint64_t index() const noexcept { return index_; }
+  void seek(const std::uint64_t index) noexcept { index_ = index; }
+  void discard(const std::uint64_t z) noexcept { index_ += z; }
+
+  /// Writes the coordinates of the next point to @p out.
+  template <class Real>
+  Real *next(Real *out)
+  {
+    static_assert(std::is_same<Real, float>::value || std::is_same<Real, double>::value,
+                  "Only float and double are supported");
+    for (std::size_t d = 0; d < dimensions_; ++d) {
+      out[d] = _::unit_fraction<Real>(shift_[d] + index_ * alpha_[d]);
+    }
+    ++index_;
+    return out + dimensions_;
+  }
+
+  /// Writes the next @p points points to @p out, one after another.
+  template <class Real>
+  Real *generate_n(Real *out, std::size_t points)
+  {
+    for (; points != 0; --points) out = next(out);
+    return out;
+  }
+
+private:
+  std::size_t dimensions_;
+  std::vector<std::uint64_t> alpha_;
+  std::vector<std::uint64_t> shift_;
+  std::uint64_t index_ = 0;
+};
+
+/// Checks whether T is one of the quasi-random sequences.
+template <class T>
+struct is_quasi_random_sequence
+  : std::integral_constant<bool, std::is_same<T, sobol_sequence>::value
+                                   || std::is_same<T, halton_sequence>::value
+                                   || std::is_same<T, r_sequence>::value> {
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_quasi_random_hpp
@@ -16,38 +16,202 @@
 
 /// @file abz/random/random.hpp
 /// Pseudorandom numbers generation.
+///
+/// Only the engines and the uniform distributions are included: the other distributions, the
+/// algorithms, views and jumps have headers of their own, to be included when they are used.
 
 #include "abz/detail/macros.hpp"
+#include "abz/random/buffered_engine.hpp"
+#include "abz/random/bulk.hpp"
+#include "abz/random/detail/bits.hpp"
+#include "abz/random/detail/uniform_int.hpp"
+#include "abz/random/pcg.hpp"
+#include "abz/random/snapshot.hpp"
+#include "abz/random/uniform_real_distribution.hpp"
+#include "abz/random/wyrand.hpp"
+#include "abz/random/xoshiro.hpp"
 #include "abz/type_traits.hpp"
 
-#include <cmath> // std::nextafter
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <random>
 #include <type_traits>
 
 ABZ_NAMESPACE_BEGIN
 
+namespace random {
+
+#if !defined(ABZ_RANDOM_DEFAULT_ENGINE)
+#define ABZ_RANDOM_DEFAULT_ENGINE std::default_random_engine
+#endif
+
+/// The engine type used when none is given to @ref abz::rand and the other library functions.
+///
+/// Defaults to <tt>std::default_random_engine</tt>. Can be changed library-wide by defining
+/// @c ABZ_RANDOM_DEFAULT_ENGINE to another engine type, for example with the CMake option of the
+/// same name:
+///
+/// @code
+/// cmake -DABZ_RANDOM_DEFAULT_ENGINE=abz::random::xoshiro256starstar
+/// @endcode
+using default_engine = ABZ_RANDOM_DEFAULT_ENGINE;
+
+} // namespace random
+
 /// @cond ABZ_INTERNAL
 namespace _ {
 
+/// Returns the initial root seed: the value of the @c ABZ_RANDOM_SEED environment variable if it
+/// is set (an unsigned number, or any other string which is then hashed), a std::random_device
+/// value otherwise.
+inline std::uint64_t initial_root_seed()
+{
+  if (const char *const env = std::getenv("ABZ_RANDOM_SEED")) {
+    // strtoull accepts leading spaces and signs, and negates "-1" into a valid number.
+    char *end;
+    const unsigned long long value = std::strtoull(env, &end, 0);
+    return *env >= '0' && *env <= '9' && *end == '\0' ? static_cast<std::uint64_t>(value)
+                                                       : fnv1a(env);
+  }
+  // NOTE(pluc) random_device can actually throw: "Throws an implementation-defined exception
+  // derived from std::exception if a random number could not be generated."
+  std::random_device device;
+  const std::uint64_t hi = device();
+  return (hi << 32) | static_cast<std::uint32_t>(device());
+}
+
+inline std::atomic<std::uint64_t> &root_seed()
+{
+  static std::atomic<std::uint64_t> seed{initial_root_seed()};
+  return seed;
+}
+
+/// Index of the calling thread: the order in which the threads first needed it, unless set.
+inline std::uint64_t &thread_index()
+{
+  static std::atomic<std::uint64_t> next{0};
+  thread_local std::uint64_t index = next++;
+  return index;
+}
+
+/// Returns the seed of the thread local instance of Engine, derived from the root seed, the index
+/// of the thread and the type of the engine.
+template <class Engine>
+std::uint64_t thread_local_engine_seed()
+{
+  return substream_seed(substream_seed(root_seed().load(), thread_index()),
+                        engine_type_hash<Engine>());
+}
+
+/// Engines constructible from a seed sequence get their whole state from it.
+template <class Engine>
+Engine make_engine(const std::uint64_t seed, std::true_type)
+{
+  std::seed_seq seq{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+  return Engine{seq};
+}
+
+template <class Engine>
+Engine make_engine(const std::uint64_t seed, std::false_type)
+{
+  return Engine{static_cast<typename Engine::result_type>(seed)};
+}
+
 /// Returns a per-thread PRNG engine.
+///
+/// The engine is seeded on first use from @ref thread_local_engine_seed, without any system call.
+/// Its type is registered for the snapshots of the thread local engines.
+///
 /// @return A reference to a thread local instance of Engine.
 template <class Engine>
 Engine &thread_local_engine()
 {
-  // NOTE(pluc) random_device can actually throw: "Throws an implementation-defined exception
-  // derived from std::exception if a random number could not be generated."
-  thread_local Engine g{std::random_device{}()};
+  thread_local Engine g = make_engine<Engine>(thread_local_engine_seed<Engine>(),
+                                              std::is_constructible<Engine, std::seed_seq &>{});
+  static_cast<void>(engine_registration<Engine>::registered);
   return g;
 }
 
+/// Returns the number of times the thread local instance of Engine has been seeded.
+template <class Engine>
+unsigned long long &thread_local_engine_epoch()
+{
+  thread_local unsigned long long epoch = 0;
+  return epoch;
+}
+
+/// Seeds the thread local instance of Engine.
+///
+/// Seeding the default engine also seeds the engine of @ref abz::random::fill, from a substream of
+/// @p value, so that a seeded thread fills ranges deterministically without both engines sharing
+/// their seed.
+template <class Engine, class Seed>
+void seed_thread_local_engine(const Seed value)
+{
+  thread_local_engine<Engine>().seed(value);
+  ++thread_local_engine_epoch<Engine>();
+  if (std::is_same<Engine, random::default_engine>::value) {
+    using bulk_engine = random::xoshiro256starstar_x8;
+    thread_local_engine<bulk_engine>().seed(
+      substream_seed(static_cast<std::uint64_t>(value), engine_type_hash<bulk_engine>()));
+    ++thread_local_engine_epoch<bulk_engine>();
+  }
+}
+
+/// Seeds the thread local instance of Engine again from the seeding hierarchy, as when it was
+/// created: the current root seed, the index of the thread and the type of the engine.
+template <class Engine>
+void reseed_thread_local_engine()
+{
+  thread_local_engine<Engine>() = make_engine<Engine>(
+    thread_local_engine_seed<Engine>(), std::is_constructible<Engine, std::seed_seq &>{});
+  ++thread_local_engine_epoch<Engine>();
+  if (std::is_same<Engine, random::default_engine>::value) {
+    using bulk_engine = random::xoshiro256starstar_x8;
+    thread_local_engine<bulk_engine>()
+      = make_engine<bulk_engine>(thread_local_engine_seed<bulk_engine>(),
+                                 std::is_constructible<bulk_engine, std::seed_seq &>{});
+    ++thread_local_engine_epoch<bulk_engine>();
+  }
+}
+
+/// Returns a per-thread instance of Distribution, used with the thread local instance of Engine.
+///
+/// The instance keeps its state between calls (e.g. the second value of a Box-Muller transform),
+/// and is reset when its parameters change or when the engine is seeded, so that a seeded thread
+/// draws the same values whatever it drew before.
+///
+/// The parameters of the previous call are kept alongside the instance: checking that they did not
+/// change is a single comparison, without the copy of Distribution::param().
+template <class Distribution, class Engine>
+Distribution &thread_local_distribution(const typename Distribution::param_type &params)
+{
+  struct cached {
+    typename Distribution::param_type params;
+    Distribution d;
+    unsigned long long epoch;
+  };
+  thread_local cached c{params, Distribution{params}, thread_local_engine_epoch<Engine>()};
+  if (c.epoch != thread_local_engine_epoch<Engine>()) {
+    c.d.reset();
+    c.epoch = thread_local_engine_epoch<Engine>();
+  }
+  if (!(c.params == params)) {
+    c.params = params;
+    c.d.param(params);
+    c.d.reset();
+  }
+  return c.d;
+}
+
 template <class T, class Engine, class Enabled = void>
 struct uniform_distribution;
 
 template <class Integral, class Engine>
 struct uniform_distribution<Integral, Engine, typename std::enable_if<std::is_integral<Integral>::value>::type> {
-  using distribution_type = std::uniform_int_distribution<Integral>;
-  using param_type = typename distribution_type::param_type;
   using result_type = Integral;
 
   static inline constexpr result_type default_min() { return result_type{0}; }
@@ -57,22 +221,33 @@ struct uniform_distribution<Integral, Engine, typename std::enable_if<std::is_in
   }
   static inline result_type get(Engine &g, const Integral a, const Integral b)
   {
-    return distribution_type{}(g, param_type{a, b});
+    return uniform_int(g, a, b);
   }
 };
 
 template <class Real, class Engine>
 struct uniform_distribution<Real, Engine, typename std::enable_if<std::is_floating_point<Real>::value>::type> {
-  using distribution_type = std::uniform_real_distribution<Real>;
-  using param_type = typename distribution_type::param_type;
   using result_type = Real;
 
   static inline constexpr result_type default_min() { return Real{0}; }
   static inline constexpr result_type default_max() { return Real{1}; }
   static inline result_type get(Engine &g, const Real a, const Real b)
   {
-    return distribution_type{}(
-      g, param_type{a, std::nextafter(b, std::numeric_limits<result_type>::max())});
+    return get(g, a, b, std::integral_constant<bool, std::is_same<Real, float>::value
+                                                     || std::is_same<Real, double>::value>{});
+  }
+
+private:
+  static inline result_type get(Engine &g, const Real a, const Real b, std::true_type)
+  {
+    return uniform_real<Real, random::interval::closed>(g, uniform_real_scale<Real>{a, b - a, a, b});
+  }
+
+  // Other floating point types (long double) have more mantissa bits than a word.
+  static inline result_type get(Engine &g, const Real a, const Real b, std::false_type)
+  {
+    const Real x = std::generate_canonical<Real, std::numeric_limits<Real>::digits>(g);
+    return std::min(std::max(a + (b - a) * x, a), b);
   }
 };
 
@@ -81,21 +256,82 @@ struct uniform_distribution<Real, Engine, typename std::enable_if<std::is_floati
 
 namespace random {
 
+/// @name Seeding hierarchy
+/// The thread local engines are seeded without system calls, from a process-wide root seed.
+///
+/// The seed of an engine is derived with SplitMix64 from the root seed, the index of its thread
+/// and a hash of its type, then expanded by a <tt>std::seed_seq</tt>. Setting the root seed (with
+/// set_root_seed() or the @c ABZ_RANDOM_SEED environment variable) therefore replays a whole
+/// multi-threaded run, as long as each thread gets the same index, for example with
+/// set_thread_index() when the thread starts.
+///
+/// @code
+/// ABZ_RANDOM_SEED=42 ./simulation
+/// ABZ_RANDOM_SEED=experiment-3 ./simulation
+/// @endcode
+/// @{
+
+/// Returns the process-wide root seed.
+///
+/// Initialized on first use from the @c ABZ_RANDOM_SEED environment variable (an unsigned number,
+/// or any other string, e.g. "-1", which is then hashed), or with std::random_device when it is
+/// not set.
+inline std::uint64_t root_seed() { return _::root_seed().load(); }
+
+/// Sets the process-wide root seed.
+///
+/// Only the thread local engines created afterwards are affected, so this is meant to be called
+/// before the threads draw their first numbers.
+inline void set_root_seed(const std::uint64_t seed) { _::root_seed().store(seed); }
+
+/// Returns the index of the calling thread in the seeding hierarchy.
+///
+/// By default, threads are numbered in the order in which their first thread local engine is
+/// created.
+inline std::uint64_t thread_index() { return _::thread_index(); }
+
+/// Sets the index of the calling thread in the seeding hierarchy.
+///
+/// Only the thread local engines created afterwards are affected, so this is meant to be called
+/// when the thread starts. Distinct threads should get distinct indices.
+inline void set_thread_index(const std::uint64_t index) { _::thread_index() = index; }
+
+/// Seeds the thread local instance of Engine again from the seeding hierarchy.
+///
+/// The seed is derived, without any system call, from the current root seed, the index of the
+/// calling thread and the type of the engine: the engine restarts from the state it had when it
+/// was created, or from a new one after set_root_seed() or set_thread_index(). As with seed(),
+/// resetting the default engine also resets the engine of @ref fill.
+///
+/// @tparam Engine The type of engine for which the instance will be reset.
+template <class Engine = random::default_engine>
+inline void reset_thread_engine()
+{
+  _::reseed_thread_local_engine<Engine>();
+}
+
+/// @} Seeding hierarchy
+
 /// @brief Seeds the internal thread local engine with a new value.
 ///
-/// The seed value is generated using std::random_device.
+/// The seed value is generated using std::random_device, so that the engine moves to a stream it
+/// has not produced yet (e.g. in a child process after a fork). See reset_thread_engine() to
+/// restart it from the seeding hierarchy instead.
 ///
 /// The library keep a local thread instance of each engine. Multiple calls from the same thread and
 /// using the same Engine type will use the same generator. This function seeds the Engine's
-/// instance of the calling thread.
+/// instance of the calling thread, and resets the thread local distributions used with it by @ref
+/// abz::rand. Seeding the default engine also seeds the @ref xoshiro256starstar_x8 used by @ref
+/// fill, with a seed derived from the one of the default engine; seeding
+/// <tt>xoshiro256starstar_x8</tt> seeds the engine of @ref fill alone.
 ///
 /// @tparam Engine The type of engine for which the instance will be seeded.
 ///
 /// @see seed(const Engine::result_type) rand
-template <class Engine = std::default_random_engine>
+template <class Engine = random::default_engine>
 inline void seed()
 {
-  _::thread_local_engine<Engine>().seed(std::random_device{}());
+  _::seed_thread_local_engine<Engine>(std::random_device{}());
 }
 
 /// @overload
@@ -103,10 +339,10 @@ inline void seed()
 /// @param value The new seed value
 ///
 /// @see seed rand
-template <class Engine = std::default_random_engine>
+template <class Engine = random::default_engine>
 inline void seed(const typename Engine::result_type value)
 {
-  _::thread_local_engine<Engine>().seed(value);
+  _::seed_thread_local_engine<Engine>(value);
 }
 
 } // namespace random
@@ -127,15 +363,11 @@ inline void seed(const typename Engine::result_type value)
 ///
 /// Requires that
 /// @li \f$a \leq b\f$ for integral types
-/// @li \f$(a \leq b) \land (b < MAX(T)) \land ((b - a) < MAX(T))\f$ for floating point
-/// types
+/// @li \f$(a \leq b) \land ((b - a) < MAX(T))\f$ for floating point types
 ///
-/// @warning For floating point types, some existing implementations have a bug where they may
-/// occasionally return b (that is, std::nextafter(b, std::numeric_limits<Real>::max()) for this
-/// function). <a href="https://gcc.gnu.org/bugzilla/show_bug.cgi?id=63176" target="_blank">GCC
-/// #63176</a> <a href="https://llvm.org/bugs/show_bug.cgi?id=18767" target="_blank">LLVM
-/// #18767</a> <a href="http://open-std.org/JTC1/SC22/WG21/docs/lwg-active.html#2524"
-/// target="_blank">LWG #2524</a>.
+/// Floating point values are built from the mantissa bits of a single output of the engine, see
+/// @ref random::uniform_real_distribution (with the random::interval::closed interval). Both
+/// bounds can be returned, and no value outside of \f$[a, b]\f$ ever is.
 ///
 /// @param e A reference to a randon bit generator.
 /// @param a, b The interval of the generated numbers
@@ -164,7 +396,7 @@ inline auto rand(Engine &e,
 /// @endcode
 ///
 /// @see random::seed()
-template <class T, class Engine = std::default_random_engine>
+template <class T, class Engine = random::default_engine>
 inline auto rand(T const a = _::uniform_distribution<T, Engine>::default_min(),
                  T const b = _::uniform_distribution<T, Engine>::default_max()) ->
   typename _::uniform_distribution<T, Engine>::result_type
@@ -214,18 +446,21 @@ inline auto rand(Engine &e, Params &&... params) -> typename Distribution::resul
 
 /// @overload
 ///
-/// This overload uses a thread local random bit generator.
+/// This overload uses a thread local random bit generator, and a thread local instance of
+/// Distribution that keeps its state across calls. The instance is reset when @p params differ
+/// from the ones of the previous call, and when the engine is seeded with @ref random::seed.
 ///
 /// @code
 /// using Dist = std::normal_distribution<double>;
 /// Dist::param_type params{0., 1.}; // The distribution parameters
-/// const auto value = abz::rand<Dist>(0., 1.);
+/// const auto value = abz::rand<Dist>(params);
 /// @endcode
-template <class Distribution, class Engine = std::default_random_engine>
+template <class Distribution, class Engine = random::default_engine>
 inline auto
 rand(const typename Distribution::param_type &params) -> typename Distribution::result_type
 {
-  return rand<Distribution>(_::thread_local_engine<Engine>(), params);
+  return _::thread_local_distribution<Distribution, Engine>(params)(
+    _::thread_local_engine<Engine>());
 }
 
 /// @overload
@@ -238,7 +473,7 @@ rand(const typename Distribution::param_type &params) -> typename Distribution::
 /// const auto value = abz::rand<Dist>(0., 1.);
 /// @endcode
 template <class Distribution,
-          class Engine = std::default_random_engine,
+          class Engine = random::default_engine,
           class... Params,
           class = typename std::enable_if<all<std::is_arithmetic<Params>...>::value>::type>
 inline auto rand(Params &&... params) -> typename Distribution::result_type
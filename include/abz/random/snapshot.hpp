@@ -0,0 +1,274 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_snapshot_hpp
+#define abz_random_snapshot_hpp
+
+/// @file abz/random/snapshot.hpp
+/// Binary snapshots of engine states.
+///
+/// A snapshot is a fixed-size record: a snapshot_header followed by the bytes of the engine,
+/// padded to a multiple of 8 bytes. Saving and restoring it is a copy of memory, so snapshots can
+/// be written to and read from memory mapped files directly. They are only meant to be restored by
+/// the same build of a program: the engine type is identified by a hash of its name and its size.
+///
+/// @code
+/// std::vector<unsigned char> checkpoint(abz::random::thread_local_engines_snapshot_size());
+/// abz::random::snapshot_thread_local_engines(checkpoint.data(), checkpoint.size());
+/// // ...
+/// abz::random::restore_thread_local_engines(checkpoint.data(), checkpoint.size());
+/// @endcode
+
+#include "abz/compiler.hpp"
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// Header of an engine snapshot.
+struct snapshot_header {
+  std::uint32_t magic;   ///< snapshot_magic.
+  std::uint32_t version; ///< snapshot_version.
+  std::uint64_t type;    ///< Hash of the name of the engine type.
+  std::uint64_t size;    ///< Size of the engine, in bytes.
+};
+
+/// The first bytes of a snapshot: "ABZR".
+constexpr std::uint32_t snapshot_magic = 0x525A4241u;
+
+/// The version of the snapshot format.
+constexpr std::uint32_t snapshot_version = 1;
+
+/// Whether the state of Engine can be snapshotted: it must be trivially copyable.
+template <class Engine>
+struct is_snapshottable : std::is_trivially_copyable<Engine> {
+};
+
+} // namespace random
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Rounds @p size up to a multiple of 8 bytes.
+constexpr std::size_t snapshot_padded(const std::size_t size) noexcept
+{
+  return (size + 7) / 8 * 8;
+}
+
+/// Identifies Engine within a build.
+///
+/// Hashes the signature of this function, which names Engine, rather than
+/// <tt>typeid(Engine).name()</tt>, so that builds without RTTI (@c -fno-rtti) are supported.
+template <class Engine>
+std::uint64_t engine_type_hash()
+{
+#if defined(ABZ_COMPILER_GCC) || defined(ABZ_COMPILER_CLANG)
+  static const std::uint64_t hash = fnv1a(__PRETTY_FUNCTION__);
+#elif defined(_MSC_VER)
+  static const std::uint64_t hash = fnv1a(__FUNCSIG__);
+#else
+  static const std::uint64_t hash = fnv1a(typeid(Engine).name());
+#endif
+  return hash;
+}
+
+/// Writes a snapshot of the @p size bytes of @p state, of type @p type, to @p buffer.
+inline std::size_t snapshot(const std::uint64_t type,
+                            const void *state,
+                            const std::size_t size,
+                            void *buffer) noexcept
+{
+  const random::snapshot_header header{random::snapshot_magic, random::snapshot_version, type,
+                                       size};
+  unsigned char *out = static_cast<unsigned char *>(buffer);
+  std::memcpy(out, &header, sizeof(header));
+  std::memcpy(out + sizeof(header), state, size);
+  std::memset(out + sizeof(header) + size, 0, snapshot_padded(size) - size);
+  return sizeof(header) + snapshot_padded(size);
+}
+
+/// Reads the header of the snapshot in @p buffer, returning whether it is valid.
+inline bool read_snapshot_header(const void *buffer, random::snapshot_header &header) noexcept
+{
+  std::memcpy(&header, buffer, sizeof(header));
+  return header.magic == random::snapshot_magic && header.version == random::snapshot_version;
+}
+
+template <class Engine>
+Engine &thread_local_engine();
+
+template <class Engine>
+unsigned long long &thread_local_engine_epoch();
+
+/// A thread local engine type: how to reach the instance of the calling thread.
+struct engine_record {
+  std::uint64_t type;
+  std::size_t size;
+  void *(*instance)();
+  void (*restored)();
+};
+
+/// The thread local engine types of the program that can be snapshotted.
+///
+/// Filled during the static initialization, before the threads get a chance to use it.
+inline std::vector<engine_record> &engine_registry()
+{
+  static std::vector<engine_record> registry;
+  return registry;
+}
+
+template <class Engine>
+bool register_engine(std::true_type)
+{
+  engine_registry().push_back(
+    {engine_type_hash<Engine>(), sizeof(Engine),
+     []() -> void * { return &thread_local_engine<Engine>(); },
+     []() { ++thread_local_engine_epoch<Engine>(); }});
+  return true;
+}
+
+template <class Engine>
+bool register_engine(std::false_type)
+{
+  return false;
+}
+
+/// Registers Engine in the engine_registry() when the program uses its thread local instance.
+template <class Engine>
+struct engine_registration {
+  static bool registered;
+};
+
+template <class Engine>
+bool engine_registration<Engine>::registered
+  = register_engine<Engine>(random::is_snapshottable<Engine>{});
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @name Snapshots of engines
+/// @{
+
+/// Returns the size of a snapshot of Engine, in bytes.
+template <class Engine>
+constexpr std::size_t snapshot_size() noexcept
+{
+  return sizeof(snapshot_header) + _::snapshot_padded(sizeof(Engine));
+}
+
+/// Writes a snapshot of @p e to @p buffer, which must hold snapshot_size<Engine>() bytes.
+///
+/// @return The number of bytes written.
+template <class Engine>
+std::size_t snapshot(const Engine &e, void *buffer)
+{
+  static_assert(is_snapshottable<Engine>::value, "The engine must be trivially copyable");
+  return _::snapshot(_::engine_type_hash<Engine>(), &e, sizeof(Engine), buffer);
+}
+
+/// Restores @p e from the snapshot in @p buffer.
+///
+/// @return false, leaving @p e unchanged, if @p buffer does not hold a snapshot of an Engine.
+template <class Engine>
+bool restore(Engine &e, const void *buffer)
+{
+  static_assert(is_snapshottable<Engine>::value, "The engine must be trivially copyable");
+  snapshot_header header;
+  if (!_::read_snapshot_header(buffer, header) || header.type != _::engine_type_hash<Engine>()
+      || header.size != sizeof(Engine)) {
+    return false;
+  }
+  std::memcpy(static_cast<void *>(&e), static_cast<const unsigned char *>(buffer) + sizeof(header),
+              sizeof(Engine));
+  return true;
+}
+
+/// @}
+
+/// @name Snapshots of the thread local engines
+/// The thread local engines of all the (trivially copyable) engine types used by the program with
+/// @ref abz::rand and the other library functions, snapshotted at once.
+///
+/// The snapshot is the concatenation of the snapshots of the engines, and its size is fixed for a
+/// given program. The engines the calling thread has not used yet are created, and restoring an
+/// engine resets the thread local distributions used with it, as @ref seed does.
+/// @{
+
+/// Returns the size of a snapshot of the thread local engines, in bytes.
+inline std::size_t thread_local_engines_snapshot_size()
+{
+  std::size_t size = 0;
+  for (const _::engine_record &r : _::engine_registry()) {
+    size += sizeof(snapshot_header) + _::snapshot_padded(r.size);
+  }
+  return size;
+}
+
+/// Writes a snapshot of the thread local engines of the calling thread to @p buffer.
+///
+/// @return The number of bytes written, or 0 if @p size is less than
+/// thread_local_engines_snapshot_size().
+inline std::size_t snapshot_thread_local_engines(void *buffer, const std::size_t size)
+{
+  if (size < thread_local_engines_snapshot_size()) return 0;
+  unsigned char *out = static_cast<unsigned char *>(buffer);
+  for (const _::engine_record &r : _::engine_registry()) {
+    out += _::snapshot(r.type, r.instance(), r.size, out);
+  }
+  return static_cast<std::size_t>(out - static_cast<unsigned char *>(buffer));
+}
+
+/// Restores the thread local engines of the calling thread from the snapshot in @p buffer, of @p
+/// size bytes.
+///
+/// @return false if the snapshot is not valid or holds an engine type the program does not use.
+/// The engines that precede the faulty record are restored.
+inline bool restore_thread_local_engines(const void *buffer, const std::size_t size)
+{
+  const unsigned char *in = static_cast<const unsigned char *>(buffer);
+  for (const unsigned char *const end = in + size; in != end;) {
+    snapshot_header header;
+    if (static_cast<std::size_t>(end - in) < sizeof(header) || !_::read_snapshot_header(in, header)
+        || static_cast<std::size_t>(end - in) - sizeof(header) < _::snapshot_padded(header.size)) {
+      return false;
+    }
+    const _::engine_record *record = nullptr;
+    for (const _::engine_record &r : _::engine_registry()) {
+      if (r.type == header.type && r.size == header.size) record = &r;
+    }
+    if (record == nullptr) return false;
+    std::memcpy(record->instance(), in + sizeof(header), record->size);
+    record->restored();
+    in += sizeof(header) + _::snapshot_padded(record->size);
+  }
+  return true;
+}
+
+/// @}
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_snapshot_hpp
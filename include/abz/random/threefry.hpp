@@ -0,0 +1,115 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_threefry_hpp
+#define abz_random_threefry_hpp
+
+/// @file abz/random/threefry.hpp
+/// Threefry counter-based engines.
+///
+/// @reference J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw. Parallel random numbers: as easy
+/// as 1, 2, 3. SC'11.
+/// @reference https://github.com/DEShawResearch/random123
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/counter_based_engine.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+ABZ_NAMESPACE_BEGIN
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+template <class UIntType>
+struct threefry_constants;
+
+template <>
+struct threefry_constants<std::uint32_t> {
+  static constexpr std::uint32_t parity = 0x1BD11BDAu;
+  static unsigned rotation(const std::size_t r, const std::size_t i) noexcept
+  {
+    static constexpr unsigned table[8][2]
+      = {{10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}};
+    return table[r % 8][i];
+  }
+};
+
+template <>
+struct threefry_constants<std::uint64_t> {
+  static constexpr std::uint64_t parity = 0x1BD11BDAA9FC1A22u;
+  static unsigned rotation(const std::size_t r, const std::size_t i) noexcept
+  {
+    static constexpr unsigned table[8][2]
+      = {{14, 16}, {52, 57}, {23, 40}, {5, 37}, {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+    return table[r % 8][i];
+  }
+};
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @class threefry
+/// @brief The Threefry4xW keyed bijection.
+///
+/// @tparam UIntType The word type (<tt>std::uint32_t</tt> or <tt>std::uint64_t</tt>).
+/// @tparam Rounds The number of rounds (20 is the recommended value).
+template <class UIntType, std::size_t Rounds = 20>
+struct threefry {
+  using result_type = UIntType;
+  using counter_type = std::array<UIntType, 4>;
+  using key_type = std::array<UIntType, 4>;
+
+  /// Returns the image of @p ctr by the bijection keyed with @p key.
+  static counter_type apply(counter_type x, const key_type &key) noexcept
+  {
+    using c = _::threefry_constants<UIntType>;
+    UIntType ks[5];
+    ks[4] = c::parity;
+    for (std::size_t i = 0; i < 4; ++i) {
+      ks[i] = key[i];
+      ks[4] ^= key[i];
+      x[i] = static_cast<UIntType>(x[i] + key[i]);
+    }
+    for (std::size_t r = 0; r < Rounds; ++r) {
+      const std::size_t a = (r % 2 == 0) ? 1 : 3, b = (r % 2 == 0) ? 3 : 1;
+      x[0] = static_cast<UIntType>(x[0] + x[a]);
+      x[a] = _::rotl(x[a], c::rotation(r, 0)) ^ x[0];
+      x[2] = static_cast<UIntType>(x[2] + x[b]);
+      x[b] = _::rotl(x[b], c::rotation(r, 1)) ^ x[2];
+      if (r % 4 == 3) {
+        const std::size_t s = (r + 1) / 4;
+        for (std::size_t i = 0; i < 4; ++i) x[i] = static_cast<UIntType>(x[i] + ks[(s + i) % 5]);
+        x[3] = static_cast<UIntType>(x[3] + s);
+      }
+    }
+    return x;
+  }
+};
+
+/// Threefry engine with four 32-bit words and 20 rounds.
+using threefry4x32 = counter_based_engine<threefry<std::uint32_t>>;
+
+/// Threefry engine with four 64-bit words and 20 rounds.
+using threefry4x64 = counter_based_engine<threefry<std::uint64_t>>;
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_threefry_hpp
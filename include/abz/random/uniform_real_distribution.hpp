@@ -0,0 +1,377 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_uniform_real_distribution_hpp
+#define abz_random_uniform_real_distribution_hpp
+
+/// @file abz/random/uniform_real_distribution.hpp
+/// Uniform floating point numbers built from random bits.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/buffered_engine.hpp"
+#include "abz/random/detail/simd.hpp"
+#include "abz/random/detail/uniform_int.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// Bounds included in the interval of a uniform floating point distribution.
+enum class interval {
+  closed_open, ///< \f$[a, b)\f$
+  open_closed, ///< \f$(a, b]\f$
+  closed,      ///< \f$[a, b]\f$
+  open         ///< \f$(a, b)\f$
+};
+
+} // namespace random
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Parameters of the canonical conversion giving values of the unit interval with the bounds of
+/// Interval.
+///
+/// The values are the multiples of \f$2^{-p}\f$ of the interval (\f$p\f$ being the number of
+/// explicit mantissa bits), the open bounds shift them by half a step and the closed interval gives
+/// half the probability of the others to both of its bounds.
+template <class Real, random::interval Interval>
+struct canonical_traits {
+  using word_type = typename std::conditional<std::is_same<Real, float>::value,
+                                              std::uint32_t,
+                                              std::uint64_t>::type;
+
+  static canonical_params<Real> params() noexcept
+  {
+    constexpr bool closed = Interval == random::interval::closed;
+    return {std::numeric_limits<word_type>::digits - (std::numeric_limits<Real>::digits - 1)
+              - (closed ? 1u : 0u),
+            closed || Interval == random::interval::open_closed ? 1u : 0u, closed ? 1u : 0u,
+            Interval == random::interval::open
+              ? Real{1} - std::numeric_limits<Real>::epsilon() / 2
+              : Real{1}};
+  }
+};
+
+/// Fills @p words with @p n 64-bit words drawn from @p g, in bulk when the engine supports it.
+template <class Engine>
+inline void random_words(Engine &g, std::uint64_t *words, const std::size_t n, std::true_type)
+{
+  generate(g, words, words + n);
+}
+
+template <class Engine>
+inline void random_words(Engine &g, std::uint64_t *words, const std::size_t n, std::false_type)
+{
+  for (std::size_t i = 0; i < n; ++i) words[i] = random_bits<std::uint64_t>(g);
+}
+
+template <class Engine>
+inline void random_words(Engine &g, std::uint64_t *words, const std::size_t n)
+{
+  random_words(g, words, n,
+               std::integral_constant<bool, engine_bits<Engine>::value == 64
+                                              && std::is_same<typename Engine::result_type,
+                                                              std::uint64_t>::value>{});
+}
+
+/// Affine map of the unit interval onto \f$[a, b]\f$, clamped to the values of the interval so
+/// that rounding never returns an excluded bound.
+template <class Real>
+struct uniform_real_scale {
+  Real a;
+  Real width;
+  Real lo;
+  Real hi;
+
+  Real operator()(const Real x) const noexcept { return std::min(std::max(a + width * x, lo), hi); }
+};
+
+template <class Real, random::interval Interval>
+inline uniform_real_scale<Real> make_uniform_real_scale(const Real a, const Real b) noexcept
+{
+  const bool open_a = Interval == random::interval::open_closed || Interval == random::interval::open;
+  const bool open_b = Interval == random::interval::closed_open || Interval == random::interval::open;
+  return {a, b - a, open_a ? std::nextafter(a, b) : a, open_b ? std::nextafter(b, a) : b};
+}
+
+/// Number of whole bits of a range of @p r values (0 standing for \f$2^{64}\f$).
+constexpr unsigned range_bits(const std::uint64_t r) noexcept
+{
+  return r == 0 ? 64 : r == 1 ? 0 : 1 + range_bits(r >> 1);
+}
+
+/// Returns a value of \f$[0, 1]\f$ built from as few outputs of the narrow engine @p g as the
+/// mantissa of Real needs, as <tt>std::generate_canonical</tt> does: \f$\sum_i x_i R^i / R^k\f$.
+template <class Real, class Engine>
+inline Real canonical_sum(Engine &g)
+{
+  constexpr std::uint64_t r = engine_range<Engine>::value;
+  constexpr unsigned bits = range_bits(r);
+  constexpr unsigned k = (std::numeric_limits<Real>::digits + bits - 1) / bits;
+  const Real range = r == 0 ? Real{18446744073709551616.} : static_cast<Real>(r);
+  Real sum = static_cast<Real>(native_word(g));
+  Real factor = range;
+  for (unsigned i = 1; i < k; ++i) {
+    sum += static_cast<Real>(native_word(g)) * factor;
+    factor *= range;
+  }
+  return sum / factor;
+}
+
+template <class Real, random::interval Interval, class Engine>
+inline Real uniform_real(Engine &g, const uniform_real_scale<Real> &scale, std::false_type)
+{
+  using traits = canonical_traits<Real, Interval>;
+  return scale(canonical(random_bits<typename traits::word_type>(g), traits::params()));
+}
+
+// The excluded bounds are left to the clamping of the scale.
+template <class Real, random::interval Interval, class Engine>
+inline Real uniform_real(Engine &g, const uniform_real_scale<Real> &scale, std::true_type)
+{
+  return scale(canonical_sum<Real>(g));
+}
+
+/// Draws a value uniformly distributed on the interval, from a single word of @p g.
+///
+/// The engines whose outputs are not whole 32 or 64-bit words (e.g. <tt>std::minstd_rand</tt>)
+/// take as many outputs as the mantissa needs instead: one per float and two per double for a
+/// 31-bit engine.
+template <class Real, random::interval Interval, class Engine>
+inline Real uniform_real(Engine &g, const uniform_real_scale<Real> &scale)
+{
+  return uniform_real<Real, Interval>(
+    g, scale, std::integral_constant<bool, engine_bits<Engine>::value == 0>{});
+}
+
+/// Writes @p n values uniformly distributed on the interval to @p first.
+///
+/// Draws one 64-bit word per double (per pair of floats), converted with the vectorized canonical
+/// kernels. The values of narrow engines are drawn one by one.
+template <class Real, random::interval Interval, class Engine, class OutputIterator>
+OutputIterator uniform_real_n(Engine &g,
+                              OutputIterator first,
+                              std::size_t n,
+                              const uniform_real_scale<Real> &scale)
+{
+  if (engine_bits<Engine>::value == 0) {
+    for (; n != 0; --n, ++first) *first = uniform_real<Real, Interval>(g, scale);
+    return first;
+  }
+  constexpr std::size_t per_word = sizeof(std::uint64_t) / sizeof(Real);
+  constexpr std::size_t chunk = 256;
+  const canonical_params<Real> params = canonical_traits<Real, Interval>::params();
+  const simd_isa isa = simd_isa_in_use();
+  alignas(64) std::uint64_t words[chunk];
+  alignas(64) Real values[chunk * per_word];
+  while (n != 0) {
+    const std::size_t m = std::min(chunk, (n + per_word - 1) / per_word);
+    const std::size_t count = std::min(n, m * per_word);
+    random_words(g, words, m);
+    canonical(isa, words, values, m, params);
+    for (std::size_t i = 0; i < count; ++i) values[i] = scale(values[i]);
+    first = std::copy(values, values + count, first);
+    n -= count;
+  }
+  return first;
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @class uniform_real_distribution
+/// @brief Floating point values uniformly distributed on an interval.
+///
+/// Satisfies the RandomNumberDistribution concept. Unlike <tt>std::uniform_real_distribution</tt>,
+/// each value is built from the mantissa bits of a single engine output (a 64-bit word per double,
+/// a 32-bit word per float), and the bounds are explicit: @p Interval tells which of @c a and @c b
+/// can be returned, and rounding never returns an excluded bound.
+///
+/// The values of the unit interval are the multiples of \f$2^{-52}\f$ (\f$2^{-23}\f$ for floats),
+/// shifted by half a step for the open intervals, before being mapped onto \f$[a, b]\f$. Engines
+/// whose outputs are not whole 32 or 64-bit words (e.g. <tt>std::minstd_rand</tt>) combine as many
+/// outputs as the mantissa needs, like <tt>std::generate_canonical</tt>.
+///
+/// generate() writes whole ranges at once, converting the words with the widest vector instructions
+/// of the running CPU.
+///
+/// @code
+/// abz::random::uniform_real_distribution<double, abz::random::interval::open> d{-1., 1.};
+/// std::vector<double> values(1024);
+/// d.generate(values.begin(), values.end(), engine);
+/// @endcode
+///
+/// Requires \f$a < b\f$ (or \f$a \leq b\f$ for the closed interval) and \f$b - a\f$ finite.
+///
+/// @tparam Real @c float or @c double.
+/// @tparam Interval The bounds included in the interval.
+template <class Real = double, interval Interval = interval::closed_open>
+class uniform_real_distribution {
+  static_assert(std::is_same<Real, float>::value || std::is_same<Real, double>::value,
+                "Only float and double are supported");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = Real; ///< The floating point type generated.
+
+  /// The parameters of the distribution.
+  class param_type {
+  public:
+    using distribution_type = uniform_real_distribution;
+
+    explicit param_type(const Real a = Real{0}, const Real b = Real{1})
+      : scale_(_::make_uniform_real_scale<Real, Interval>(a, b))
+      , b_(b)
+    {
+    }
+
+    Real a() const noexcept { return scale_.a; }
+    Real b() const noexcept { return b_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.a() == rhs.a() && lhs.b() == rhs.b();
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class uniform_real_distribution;
+
+    _::uniform_real_scale<Real> scale_;
+    Real b_;
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  uniform_real_distribution() : uniform_real_distribution(Real{0}) {}
+
+  explicit uniform_real_distribution(const Real a, const Real b = Real{1})
+    : p_(a, b)
+  {
+  }
+
+  explicit uniform_real_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  /// Returns a value uniformly distributed on the interval.
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  /// Returns a value uniformly distributed on the interval of @p p.
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return _::uniform_real<Real, Interval>(g, p.scale_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values uniformly distributed on the interval.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values uniformly distributed on the interval of @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    _::uniform_real_n<Real, Interval>(g, first, static_cast<std::size_t>(std::distance(first, last)),
+                                      p.scale_);
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  result_type a() const noexcept { return p_.a(); }
+  result_type b() const noexcept { return p_.b(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return a(); }
+  result_type max() const noexcept { return b(); }
+
+  /// @}
+
+  friend bool operator==(const uniform_real_distribution &lhs, const uniform_real_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const uniform_real_distribution &lhs, const uniform_real_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const uniform_real_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<Real>::max_digits10);
+    os << d.a() << os.widen(' ') << d.b();
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       uniform_real_distribution &d)
+  {
+    Real a, b;
+    if (is >> a >> b) d.param(param_type{a, b});
+    return is;
+  }
+
+private:
+  param_type p_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_uniform_real_distribution_hpp
@@ -0,0 +1,257 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_view_hpp
+#define abz_random_view_hpp
+
+/// @file abz/random/view.hpp
+/// Lazily computed sequences of random numbers.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/simd.hpp"
+#include "abz/random/philox.hpp"
+#include "abz/random/uniform_real_distribution.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+/// @cond ABZ_INTERNAL
+namespace _ {
+
+/// Converts a word into a value of the default range of @ref abz::random::fill.
+template <class Real>
+inline typename std::enable_if<std::is_floating_point<Real>::value, Real>::type
+  view_value(const std::uint64_t w) noexcept
+{
+  using traits = canonical_traits<Real, random::interval::closed>;
+  using word_type = typename traits::word_type;
+  return canonical(static_cast<word_type>(w >> (64 - std::numeric_limits<word_type>::digits)),
+                   traits::params());
+}
+
+template <class Integral>
+inline typename std::enable_if<std::is_integral<Integral>::value, Integral>::type
+  view_value(const std::uint64_t w) noexcept
+{
+  using unsigned_type = typename make_unsigned<Integral>::type;
+  // The high bits are the best ones, and the sign bit is cleared as in abz::rand<Integral>().
+  return static_cast<Integral>(
+    static_cast<unsigned_type>(w >> (64 - std::numeric_limits<Integral>::digits))
+    & static_cast<unsigned_type>(std::numeric_limits<Integral>::max()));
+}
+
+} // namespace _
+/// @endcond ABZ_INTERNAL
+
+namespace random {
+
+/// @class view
+/// @brief A random access range of random numbers computed on demand.
+///
+/// Element \f$i\f$ is computed from the output number \f$i\f$ of the counter-based engine @ref
+/// philox4x64 keyed with the seed and the stream of the view, so that reading it costs a fraction
+/// of a Philox round and no memory: the view is a few words, whatever its size. Elements are
+/// floating point values of \f$[0, 1]\f$ or integral values of \f$[0, MAX(T)]\f$, like the values
+/// of @ref fill, and depend only on the seed, the stream and their index.
+///
+/// The iterators hold the key of the view, so they outlive it, and cache the last block of Philox
+/// outputs they computed: a sequential traversal costs a quarter of a block per element. Their
+/// reference type is @p T itself: the standard algorithms accept them as random access iterators
+/// as long as they do not write through them.
+///
+/// @code
+/// const abz::random::view<double> noise{seed, 1ull << 40}; // 8 TB worth of doubles in 24 bytes
+/// const double x = noise[123456789];
+/// std::vector<double> slice(noise.begin() + offset, noise.begin() + offset + 1024);
+/// @endcode
+///
+/// @tparam T An integral type, @c float or @c double.
+template <class T>
+class view {
+  static_assert(std::is_integral<T>::value || std::is_same<T, float>::value
+                  || std::is_same<T, double>::value,
+                "T must be an integral type, float or double");
+
+  using bijection = philox<std::uint64_t>;
+  static constexpr std::size_t block_size = 4;
+
+public:
+  /// @name Member types
+  /// @{
+
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T;
+  using const_reference = T;
+
+  /// Random access iterator over the elements of a view.
+  class iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    iterator() = default;
+
+    T operator*() const
+    {
+      const std::uint64_t b = index_ / block_size;
+      if (b != block_ || !cached_) {
+        block_words_ = bijection::apply({{b, 0, 0, 0}}, key_);
+        block_ = b;
+        cached_ = true;
+      }
+      return _::view_value<T>(block_words_[index_ % block_size]);
+    }
+
+    T operator[](const difference_type n) const { return *(*this + n); }
+
+    iterator &operator++()
+    {
+      ++index_;
+      return *this;
+    }
+
+    iterator operator++(int)
+    {
+      iterator it = *this;
+      ++index_;
+      return it;
+    }
+
+    iterator &operator--()
+    {
+      --index_;
+      return *this;
+    }
+
+    iterator operator--(int)
+    {
+      iterator it = *this;
+      --index_;
+      return it;
+    }
+
+    iterator &operator+=(const difference_type n)
+    {
+      index_ = static_cast<std::uint64_t>(static_cast<difference_type>(index_) + n);
+      return *this;
+    }
+
+    iterator &operator-=(const difference_type n) { return *this += -n; }
+
+    friend iterator operator+(iterator it, const difference_type n) { return it += n; }
+    friend iterator operator+(const difference_type n, iterator it) { return it += n; }
+    friend iterator operator-(iterator it, const difference_type n) { return it -= n; }
+
+    friend difference_type operator-(const iterator &lhs, const iterator &rhs)
+    {
+      return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+
+    friend bool operator==(const iterator &lhs, const iterator &rhs)
+    {
+      return lhs.index_ == rhs.index_;
+    }
+    friend bool operator!=(const iterator &lhs, const iterator &rhs) { return !(lhs == rhs); }
+    friend bool operator<(const iterator &lhs, const iterator &rhs)
+    {
+      return lhs.index_ < rhs.index_;
+    }
+    friend bool operator>(const iterator &lhs, const iterator &rhs) { return rhs < lhs; }
+    friend bool operator<=(const iterator &lhs, const iterator &rhs) { return !(rhs < lhs); }
+    friend bool operator>=(const iterator &lhs, const iterator &rhs) { return !(lhs < rhs); }
+
+  private:
+    friend class view;
+
+    iterator(const bijection::key_type &key, const std::uint64_t index) : key_(key), index_(index)
+    {
+    }
+
+    bijection::key_type key_{};
+    std::uint64_t index_ = 0;
+    mutable bijection::counter_type block_words_;
+    mutable std::uint64_t block_ = 0;
+    mutable bool cached_ = false;
+  };
+
+  using const_iterator = iterator;
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  /// Constructs a view of @p n elements, computed from the output of <tt>philox4x64{seed}</tt>
+  /// (or of its split(stream)).
+  view(const std::uint64_t seed, const size_type n, const std::uint64_t stream = 0) noexcept
+    : key_{{seed, stream}}
+    , size_(n)
+  {
+  }
+
+  /// @}
+
+  /// @name Element access
+  /// @{
+
+  /// Returns the element @p i, computing it.
+  T operator[](const size_type i) const
+  {
+    const std::uint64_t index = static_cast<std::uint64_t>(i);
+    return _::view_value<T>(
+      bijection::apply({{index / block_size, 0, 0, 0}}, key_)[index % block_size]);
+  }
+
+  T front() const { return (*this)[0]; }
+  T back() const { return (*this)[size_ - 1]; }
+
+  /// @}
+
+  /// @name Iterators
+  /// @{
+
+  iterator begin() const noexcept { return iterator{key_, 0}; }
+  iterator end() const noexcept { return iterator{key_, size_}; }
+  iterator cbegin() const noexcept { return begin(); }
+  iterator cend() const noexcept { return end(); }
+
+  /// @}
+
+  /// @name Capacity
+  /// @{
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// @}
+
+private:
+  bijection::key_type key_;
+  size_type size_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_view_hpp
@@ -0,0 +1,143 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_wyrand_hpp
+#define abz_random_wyrand_hpp
+
+/// @file abz/random/wyrand.hpp
+/// wyrand engine.
+///
+/// @reference https://github.com/wangyi-fudan/wyhash
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class wyrand
+/// @brief The wyrand 64-bit engine.
+///
+/// Satisfies the RandomNumberEngine concept. The state is a single 64-bit Weyl sequence whose
+/// output goes through a multiply-xor mixing function, hence a period of \f$2^{64}\f$ and
+/// constant-time discard(). jump() and long_jump() advance the engine by respectively
+/// \f$2^{32}\f$ and \f$2^{48}\f$ notches.
+///
+/// This is the fastest engine of the library but its state is small: prefer @ref xoshiro256starstar
+/// or @ref pcg64 when more than \f$2^{32}\f$ values are drawn by many parallel streams.
+class wyrand {
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = std::uint64_t; ///< The integer type generated.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr result_type default_seed = 0u;
+
+  /// @}
+
+  /// @name Construction and seeding
+  /// @{
+
+  wyrand() : wyrand(default_seed) {}
+
+  /// Constructs the engine with the initial state @p value.
+  explicit wyrand(const result_type value) : state_(value) {}
+
+  /// Constructs the engine with a state generated from a seed sequence.
+  template <class Sseq,
+            class = typename std::enable_if<!std::is_convertible<Sseq, result_type>::value
+                                            && !std::is_same<Sseq, wyrand>::value>::type>
+  explicit wyrand(Sseq &seq)
+  {
+    seed(seq);
+  }
+
+  /// Reinitializes the engine with the initial state @p value.
+  void seed(const result_type value = default_seed) { state_ = value; }
+
+  /// Reinitializes the engine with a state generated from a seed sequence.
+  template <class Sseq>
+  typename std::enable_if<!std::is_convertible<Sseq, result_type>::value>::type seed(Sseq &seq)
+  {
+    state_ = _::generate_words<1>(seq)[0];
+  }
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  /// Advances the engine's state and returns the generated value.
+  result_type operator()() noexcept
+  {
+    state_ += increment;
+    std::uint64_t lo;
+    const std::uint64_t hi = _::mulhilo(state_, state_ ^ 0xE7037ED1A0B428DBu, lo);
+    return hi ^ lo;
+  }
+
+  /// Advances the engine's state by @p z notches in constant time.
+  void discard(const unsigned long long z) noexcept { state_ += increment * z; }
+
+  /// Advances the engine's state by \f$2^{32}\f$ notches.
+  void jump() noexcept { discard(1ull << 32); }
+
+  /// Advances the engine's state by \f$2^{48}\f$ notches.
+  void long_jump() noexcept { discard(1ull << 48); }
+
+  /// @}
+
+  friend bool operator==(const wyrand &lhs, const wyrand &rhs) { return lhs.state_ == rhs.state_; }
+  friend bool operator!=(const wyrand &lhs, const wyrand &rhs) { return !(lhs == rhs); }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const wyrand &e)
+  {
+    return os << e.state_;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       wyrand &e)
+  {
+    return is >> e.state_;
+  }
+
+private:
+  static constexpr std::uint64_t increment = 0xA0761D6478BD642Fu;
+
+  std::uint64_t state_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_wyrand_hpp
@@ -0,0 +1,200 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_xoshiro_hpp
+#define abz_random_xoshiro_hpp
+
+/// @file abz/random/xoshiro.hpp
+/// xoshiro256** engine.
+///
+/// @reference D. Blackman, S. Vigna. Scrambled linear pseudorandom number generators. ACM
+/// Transactions on Mathematical Software, 2021.
+/// @reference http://prng.di.unimi.it/
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/bits.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class xoshiro256starstar
+/// @brief The xoshiro256** 64-bit engine.
+///
+/// Satisfies the RandomNumberEngine concept. The state is made of 256 bits and the period is
+/// \f$2^{256} - 1\f$.
+///
+/// jump() and long_jump() can be used to generate respectively \f$2^{128}\f$ and \f$2^{64}\f$
+/// non-overlapping subsequences for parallel computations.
+class xoshiro256starstar {
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = std::uint64_t;                  ///< The integer type generated.
+  using state_type = std::array<std::uint64_t, 4>; ///< The internal state.
+
+  /// @}
+
+  /// @name Member constants
+  /// @{
+
+  static constexpr result_type default_seed = 0x9E3779B97F4A7C15u;
+
+  /// @}
+
+  /// @name Construction and seeding
+  /// @{
+
+  xoshiro256starstar() : xoshiro256starstar(default_seed) {}
+
+  /// Constructs the engine with a state expanded from @p value.
+  explicit xoshiro256starstar(const result_type value) { seed(value); }
+
+  /// Constructs the engine with a state generated from a seed sequence.
+  template <class Sseq,
+            class = typename std::enable_if<!std::is_convertible<Sseq, result_type>::value
+                                            && !std::is_same<Sseq, xoshiro256starstar>::value
+                                            && !std::is_same<Sseq, state_type>::value>::type>
+  explicit xoshiro256starstar(Sseq &seq)
+  {
+    seed(seq);
+  }
+
+  /// Constructs the engine with a given state (which must not be all zeros).
+  explicit xoshiro256starstar(const state_type &state) : s_(state) {}
+
+  /// Reinitializes the engine with a state expanded from @p value with SplitMix64.
+  void seed(const result_type value = default_seed)
+  {
+    std::uint64_t x = value;
+    for (auto &s : s_) s = _::splitmix64_next(x);
+  }
+
+  /// Reinitializes the engine with a state generated from a seed sequence.
+  template <class Sseq>
+  typename std::enable_if<!std::is_convertible<Sseq, result_type>::value>::type seed(Sseq &seq)
+  {
+    s_ = _::generate_words<4>(seq);
+    if ((s_[0] | s_[1] | s_[2] | s_[3]) == 0) s_[0] = default_seed;
+  }
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  /// Advances the engine's state and returns the generated value.
+  result_type operator()() noexcept
+  {
+    const std::uint64_t r = _::rotl(s_[1] * 5, 7) * 9;
+    const std::uint64_t t = s_[1] << 17;
+    s_[2] ^= s_[0];
+    s_[3] ^= s_[1];
+    s_[1] ^= s_[2];
+    s_[0] ^= s_[3];
+    s_[2] ^= t;
+    s_[3] = _::rotl(s_[3], 45);
+    return r;
+  }
+
+  /// Advances the engine's state by @p z notches.
+  void discard(unsigned long long z) noexcept
+  {
+    for (; z != 0; --z) (*this)();
+  }
+
+  /// Advances the engine's state by \f$2^{128}\f$ notches.
+  void jump() noexcept
+  {
+    static constexpr std::uint64_t polynomial[]
+      = {0x180EC6D33CFD0ABAu, 0xD5A61266F0C9392Cu, 0xA9582618E03FC9AAu, 0x39ABDC4529B1661Cu};
+    apply(polynomial);
+  }
+
+  /// Advances the engine's state by \f$2^{192}\f$ notches.
+  void long_jump() noexcept
+  {
+    static constexpr std::uint64_t polynomial[]
+      = {0x76E15D3EFEFDCBBFu, 0xC5004E441C522FB3u, 0x77710069854EE241u, 0x39109BB02ACBE635u};
+    apply(polynomial);
+  }
+
+  /// @}
+
+  /// Returns the internal state of the engine.
+  const state_type &state() const noexcept { return s_; }
+
+  friend bool operator==(const xoshiro256starstar &lhs, const xoshiro256starstar &rhs)
+  {
+    return lhs.s_ == rhs.s_;
+  }
+
+  friend bool operator!=(const xoshiro256starstar &lhs, const xoshiro256starstar &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const xoshiro256starstar &e)
+  {
+    return os << e.s_[0] << os.widen(' ') << e.s_[1] << os.widen(' ') << e.s_[2] << os.widen(' ')
+              << e.s_[3];
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       xoshiro256starstar &e)
+  {
+    state_type s;
+    if (is >> s[0] >> s[1] >> s[2] >> s[3]) e.s_ = s;
+    return is;
+  }
+
+private:
+  // Replaces the state by the linear combination of the next 256 states given by the jump
+  // polynomial.
+  void apply(const std::uint64_t (&polynomial)[4]) noexcept
+  {
+    state_type s{};
+    for (const auto word : polynomial) {
+      for (unsigned b = 0; b < 64; ++b) {
+        if (word & (std::uint64_t{1} << b)) {
+          for (std::size_t i = 0; i < 4; ++i) s[i] ^= s_[i];
+        }
+        (*this)();
+      }
+    }
+    s_ = s;
+  }
+
+  state_type s_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_xoshiro_hpp
@@ -0,0 +1,249 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef abz_random_zipf_distribution_hpp
+#define abz_random_zipf_distribution_hpp
+
+/// @file abz/random/zipf_distribution.hpp
+/// Zipf distribution sampled with the rejection-inversion method.
+///
+/// @reference W. Hörmann, G. Derflinger. Rejection-inversion to generate variates from monotone
+/// discrete distributions. ACM Transactions on Modeling and Computer Simulation, 1996.
+
+#include "abz/detail/macros.hpp"
+#include "abz/random/detail/discrete.hpp"
+#include "abz/random/detail/ziggurat.hpp"
+
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+/// @class zipf_distribution
+/// @brief Zipf distribution sampled with the rejection-inversion method.
+///
+/// Satisfies the RandomNumberDistribution concept. Values are the ranks \f$k \in [1, n]\f$, drawn
+/// with probabilities proportional to \f$k^{-s}\f$, \f$s > 0\f$.
+///
+/// Hörmann and Derflinger's rejection-inversion inverts the integral of the continuous hat
+/// \f$x^{-s}\f$ and accepts most values with a single comparison. A value costs an exponential
+/// and a logarithm, and about 1.1 tries in the worst case. Building the parameters only takes a
+/// few evaluations of the hat: neither the time nor the memory depend on \f$n\f$, so that key
+/// spaces of billions of values cost nothing more than small ones (use a 64-bit IntType beyond
+/// the range of @c int). generate(), and thus @ref rand_n, fill whole ranges at once with words
+/// drawn in bulk.
+///
+/// @code
+/// using Zipf = abz::random::zipf_distribution<std::uint64_t>;
+/// std::vector<std::uint64_t> requests(1 << 20);
+/// abz::random::rand_n<Zipf>(engine, requests.begin(), requests.size(), 1000000000, .99);
+/// @endcode
+///
+/// @tparam IntType An integral type.
+template <class IntType = int>
+class zipf_distribution {
+  static_assert(std::is_integral<IntType>::value, "IntType must be an integral type");
+
+public:
+  /// @name Member types
+  /// @{
+
+  using result_type = IntType; ///< The integral type generated.
+
+  /// The parameters of the distribution.
+  class param_type {
+  public:
+    using distribution_type = zipf_distribution;
+
+    explicit param_type(const IntType n = 1, const double s = 1.)
+      : n_(n)
+      , s_(s)
+    {
+      h_integral_1_ = h_integral(1.5) - 1;
+      h_integral_n_ = h_integral(static_cast<double>(n) + .5);
+      squeeze_ = 2 - h_integral_inverse(h_integral(2.5) - h(2));
+    }
+
+    IntType n() const noexcept { return n_; }
+    double s() const noexcept { return s_; }
+
+    friend bool operator==(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return lhs.n_ == rhs.n_ && lhs.s_ == rhs.s_;
+    }
+
+    friend bool operator!=(const param_type &lhs, const param_type &rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend class zipf_distribution;
+
+    /// \f$\log(1 + x) / x\f$, continued at 0.
+    static double log1p_ratio(const double x) noexcept
+    {
+      if (std::fabs(x) > 1e-8) return std::log1p(x) / x;
+      return 1 - x * (.5 - x * (1. / 3 - .25 * x));
+    }
+
+    /// \f$(e^x - 1) / x\f$, continued at 0.
+    static double expm1_ratio(const double x) noexcept
+    {
+      if (std::fabs(x) > 1e-8) return std::expm1(x) / x;
+      return 1 + x * .5 * (1 + x / 3 * (1 + .25 * x));
+    }
+
+    /// The hat function \f$x^{-s}\f$.
+    double h(const double x) const noexcept { return std::exp(-s_ * std::log(x)); }
+
+    /// An integral of the hat: \f$(x^{1 - s} - 1) / (1 - s)\f$, or \f$\log x\f$ when \f$s = 1\f$.
+    double h_integral(const double x) const noexcept
+    {
+      const double log_x = std::log(x);
+      return expm1_ratio((1 - s_) * log_x) * log_x;
+    }
+
+    double h_integral_inverse(const double x) const noexcept
+    {
+      const double t = std::fmax(x * (1 - s_), -1.);
+      return std::exp(log1p_ratio(t) * x);
+    }
+
+    IntType n_;
+    double s_;
+    double h_integral_1_; // h_integral(3/2) - h(1).
+    double h_integral_n_; // h_integral(n + 1/2).
+    double squeeze_;      // Values closer to their rank are always accepted.
+  };
+
+  /// @}
+
+  /// @name Construction
+  /// @{
+
+  zipf_distribution() : zipf_distribution(1) {}
+
+  explicit zipf_distribution(const IntType n, const double s = 1.) : p_(n, s) {}
+
+  explicit zipf_distribution(const param_type &p) : p_(p) {}
+
+  /// Does nothing: the distribution has no internal state.
+  void reset() noexcept {}
+
+  /// @}
+
+  /// @name Generation
+  /// @{
+
+  template <class Engine>
+  result_type operator()(Engine &g) const
+  {
+    return (*this)(g, p_);
+  }
+
+  template <class Engine>
+  result_type operator()(Engine &g, const param_type &p) const
+  {
+    return sample(g, p);
+  }
+
+  /// Fills \f$[first, last)\f$ with Zipf distributed values.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g) const
+  {
+    generate(first, last, g, p_);
+  }
+
+  /// Fills \f$[first, last)\f$ with values following the distribution of parameters @p p.
+  template <class ForwardIterator, class Engine>
+  void generate(ForwardIterator first, ForwardIterator last, Engine &g, const param_type &p) const
+  {
+    _::generate_buffered(first, last, g,
+                         [&p](_::word_buffer<Engine> &w) { return sample(w, p); });
+  }
+
+  /// @}
+
+  /// @name Characteristics
+  /// @{
+
+  IntType n() const noexcept { return p_.n(); }
+  double s() const noexcept { return p_.s(); }
+
+  param_type param() const { return p_; }
+  void param(const param_type &p) { p_ = p; }
+
+  result_type min() const noexcept { return 1; }
+  result_type max() const noexcept { return p_.n(); }
+
+  /// @}
+
+  friend bool operator==(const zipf_distribution &lhs, const zipf_distribution &rhs)
+  {
+    return lhs.p_ == rhs.p_;
+  }
+
+  friend bool operator!=(const zipf_distribution &lhs, const zipf_distribution &rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                                       const zipf_distribution &d)
+  {
+    const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+    os << d.n() << os.widen(' ') << d.s();
+    os.precision(precision);
+    return os;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &is,
+                                                       zipf_distribution &d)
+  {
+    IntType n;
+    double s;
+    if (is >> n >> s) d.param(param_type{n, s});
+    return is;
+  }
+
+private:
+  template <class Engine>
+  static result_type sample(Engine &g, const param_type &p)
+  {
+    const double n = static_cast<double>(p.n_);
+    for (;;) {
+      const double u = p.h_integral_n_ + _::unit_open(g) * (p.h_integral_1_ - p.h_integral_n_);
+      const double x = p.h_integral_inverse(u);
+      const double k = std::fmin(std::fmax(std::floor(x + .5), 1.), n);
+      if (k - x <= p.squeeze_ || u >= p.h_integral(k + .5) - p.h(k)) {
+        return k < n ? static_cast<result_type>(k) : p.n_;
+      }
+    }
+  }
+
+  param_type p_;
+};
+
+} // namespace random
+
+ABZ_NAMESPACE_END
+
+#endif // abz_random_zipf_distribution_hpp
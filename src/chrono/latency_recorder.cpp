@@ -0,0 +1,118 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "abz/chrono/latency_recorder.hpp"
+
+/// @file chrono/latency_recorder.cpp
+/// @brief latency_recorder implementation
+
+#include <mutex>
+#include <vector>
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+namespace {
+
+/// The identifiers of the live recorders are reused, so that the shard tables of the threads are
+/// as large as the number of recorders alive at once.
+std::mutex ids_mutex;
+std::size_t next_id = 0;
+std::vector<std::size_t> free_ids;
+
+/// The serial numbers of the recorders, never reused: they tell the shards of a recorder apart
+/// from the ones of a destroyed recorder that had the same identifier.
+std::atomic<std::uint64_t> next_serial{0};
+
+/// A shard of the calling thread and the serial number of its recorder.
+struct local_shard {
+  _::latency_shard *shard;
+  std::uint64_t serial;
+};
+
+/// The shards of the calling thread, indexed by recorder identifier.
+thread_local std::vector<local_shard> local_shards;
+
+std::size_t acquire_id()
+{
+  const std::lock_guard<std::mutex> lock{ids_mutex};
+  if (free_ids.empty()) return next_id++;
+  const std::size_t id = free_ids.back();
+  free_ids.pop_back();
+  return id;
+}
+
+void release_id(const std::size_t id)
+{
+  const std::lock_guard<std::mutex> lock{ids_mutex};
+  free_ids.push_back(id);
+}
+
+} // namespace
+
+latency_recorder::latency_recorder(const bool cpu_time)
+  : id_(acquire_id())
+  , serial_(next_serial.fetch_add(1, std::memory_order_relaxed))
+  , cpu_time_(cpu_time)
+{
+}
+
+latency_recorder::~latency_recorder()
+{
+  _::latency_shard *s = shards_.load(std::memory_order_acquire);
+  while (s != nullptr) {
+    _::latency_shard *const next = s->next;
+    delete s;
+    s = next;
+  }
+  release_id(id_);
+}
+
+_::latency_shard &latency_recorder::local()
+{
+  if (id_ < local_shards.size() && local_shards[id_].serial == serial_
+      && local_shards[id_].shard != nullptr) {
+    return *local_shards[id_].shard;
+  }
+  return add_local();
+}
+
+_::latency_shard &latency_recorder::add_local()
+{
+  // The table is grown first, so that a failed allocation leaves no shard behind.
+  if (local_shards.size() <= id_) local_shards.resize(id_ + 1, local_shard{nullptr, 0});
+  _::latency_shard *const s = new _::latency_shard;
+  s->next = shards_.load(std::memory_order_relaxed);
+  while (!shards_.compare_exchange_weak(s->next, s, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+  }
+  // An entry of a destroyed recorder is overwritten: its shard was deleted with it.
+  local_shards[id_] = local_shard{s, serial_};
+  return *s;
+}
+
+latency_report latency_recorder::report() const
+{
+  latency_report r;
+  for (const _::latency_shard *s = shards_.load(std::memory_order_acquire); s != nullptr;
+       s = s->next) {
+    s->cpu.load(r.cpu);
+    s->wall.load(r.wall);
+  }
+  return r;
+}
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
@@ -0,0 +1,82 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "abz/chrono/thread_cpu_clock.hpp"
+
+/// @file chrono/thread_cpu_clock.cpp
+/// @brief thread_cpu_clock implementation
+///
+/// @reference http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_getcpuclockid.html
+///
+/// TODO:
+///  - Windows implementation (GetThreadTimes)
+///  - Apple implementation (thread_info)
+
+#include "abz/os.hpp"
+
+#if defined(ABZ_OS_POSIX)
+// _POSIX_TIMERS (unistd.h) shall be defined to 200809L.
+// _POSIX_THREAD_CPUTIME (unistd.h) shall be defined to -1, 0, or 200809L.
+#if defined(_POSIX_TIMERS) && (_POSIX_TIMERS > 0) && defined(_POSIX_THREAD_CPUTIME)
+#define ABZ_POSIX_THREAD_CPUTIME
+#include <pthread.h> // pthread_getcpuclockid, pthread_self
+#include <time.h>    // clock_gettime
+#else
+#warning Thread CPU time is not supported on your platform
+#endif
+#endif
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+#if defined(ABZ_POSIX_THREAD_CPUTIME)
+static_assert(sizeof(::clockid_t) <= sizeof(long), "clockid_t must fit in a long");
+#endif
+
+thread_cpu_clock::thread_cpu_clock() noexcept
+#if defined(ABZ_POSIX_THREAD_CPUTIME)
+  : thread_cpu_clock(::pthread_self())
+#endif
+{
+}
+
+thread_cpu_clock::thread_cpu_clock(const std::thread::native_handle_type handle) noexcept
+{
+#if defined(ABZ_POSIX_THREAD_CPUTIME)
+  ::clockid_t clock;
+  if (::pthread_getcpuclockid(handle, &clock) == 0) {
+    clock_ = static_cast<long>(clock);
+    valid_ = true;
+  }
+#else
+  static_cast<void>(handle);
+#endif
+}
+
+auto thread_cpu_clock::now() const noexcept -> time_point
+{
+#if defined(ABZ_POSIX_THREAD_CPUTIME)
+  struct ::timespec tp;
+  if (!valid_ || ::clock_gettime(static_cast<::clockid_t>(clock_), &tp) != 0) {
+    return time_point{};
+  }
+  return time_point{duration{std::chrono::seconds{tp.tv_sec} + std::chrono::nanoseconds{tp.tv_nsec}}};
+#else
+  return time_point{};
+#endif
+}
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
@@ -0,0 +1,254 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "abz/chrono/thread_cpu_sampler.hpp"
+
+/// @file chrono/thread_cpu_sampler.cpp
+/// @brief thread_cpu_sampler implementation
+///
+/// @reference man 5 proc (/proc/[pid]/task, /proc/[pid]/stat)
+/// @reference https://www.kernel.org/doc/html/latest/scheduler/sched-stats.html
+///
+/// TODO:
+///  - Windows implementation (Thread32First, GetThreadTimes)
+///  - Apple implementation (task_threads, thread_info)
+
+#include "abz/os.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(ABZ_OS_LINUX)
+#define ABZ_PROC_TASKS
+#include <dirent.h>      // opendir, readdir, rewinddir, closedir, dirfd
+#include <fcntl.h>       // openat
+#include <sys/syscall.h> // SYS_gettid
+#include <unistd.h>      // pread, close, sysconf, syscall
+#endif
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+namespace {
+
+#if defined(ABZ_PROC_TASKS)
+
+/// Parses the decimal number at the beginning of @p s.
+bool parse_decimal(const char *&s, const char *const end, std::uint64_t &value) noexcept
+{
+  const char *const first = s;
+  value = 0;
+  for (; s != end && *s >= '0' && *s <= '9'; ++s) {
+    value = value * 10 + static_cast<unsigned>(*s - '0');
+  }
+  return s != first;
+}
+
+/// Parses the CPU time in nanoseconds of a @c schedstat file: the first of its three fields.
+bool parse_schedstat(const char *s, const char *const end, std::uint64_t &nanoseconds) noexcept
+{
+  return parse_decimal(s, end, nanoseconds);
+}
+
+/// Parses the user and system times, in clock ticks, of a @c stat file: the fields 14 and 15.
+bool parse_stat(const char *s, const char *const end, std::uint64_t &ticks) noexcept
+{
+  // The command name (field 2) is within parentheses and may contain spaces and parentheses.
+  const char *p = end;
+  while (p != s && *(p - 1) != ')') --p;
+  if (p == s) return false;
+  // p is after field 2: skip the fields 3 to 13.
+  for (int field = 3; field < 14; ++field) {
+    if (p == end || *p != ' ') return false;
+    ++p;
+    while (p != end && *p != ' ') ++p;
+  }
+  std::uint64_t user, system;
+  if (p == end || *p++ != ' ' || !parse_decimal(p, end, user)) return false;
+  if (p == end || *p++ != ' ' || !parse_decimal(p, end, system)) return false;
+  ticks = user + system;
+  return true;
+}
+
+::DIR *directory(void *tasks) noexcept
+{
+  return static_cast<::DIR *>(tasks);
+}
+
+int open_task(void *tasks, const long id, const bool schedstat) noexcept
+{
+  // Large enough for "<tid>/schedstat".
+  char path[32];
+  char *p = path + sizeof(path);
+  *--p = '\0';
+  const char *const file = schedstat ? "/schedstat" : "/stat";
+  const char *f = file;
+  while (*f != '\0') ++f;
+  while (f != file) *--p = *--f;
+  unsigned long n = static_cast<unsigned long>(id);
+  do {
+    *--p = static_cast<char>('0' + n % 10);
+    n /= 10;
+  } while (n != 0);
+  return ::openat(::dirfd(directory(tasks)), p, O_RDONLY | O_CLOEXEC);
+}
+
+/// Nanoseconds per clock tick of the @c stat files.
+std::int64_t tick_nanoseconds() noexcept
+{
+  static const std::int64_t ns = [] {
+    const long ticks = ::sysconf(_SC_CLK_TCK);
+    return ticks > 0 ? 1000000000 / ticks : 10000000;
+  }();
+  return ns;
+}
+
+/// Reads the CPU time of the @c schedstat or @c stat file open as @p fd.
+bool read_cpu_time(const int fd, const bool schedstat, std::int64_t &nanoseconds) noexcept
+{
+  char buffer[1024];
+  const ::ssize_t size = ::pread(fd, buffer, sizeof(buffer), 0);
+  if (size <= 0) return false;
+  std::uint64_t value;
+  if (schedstat) {
+    if (!parse_schedstat(buffer, buffer + size, value)) return false;
+    nanoseconds = static_cast<std::int64_t>(value);
+  } else {
+    if (!parse_stat(buffer, buffer + size, value)) return false;
+    nanoseconds = static_cast<std::int64_t>(value) * tick_nanoseconds();
+  }
+  return true;
+}
+
+#endif
+
+} // namespace
+
+long this_thread_id() noexcept
+{
+#if defined(ABZ_PROC_TASKS)
+  return static_cast<long>(::syscall(SYS_gettid));
+#else
+  return -1;
+#endif
+}
+
+thread_cpu_sampler::thread_cpu_sampler() noexcept
+{
+#if defined(ABZ_PROC_TASKS)
+  tasks_ = ::opendir("/proc/self/task");
+  if (tasks_ == nullptr) return;
+  // schedstat requires a kernel built with CONFIG_SCHED_INFO.
+  const int fd = open_task(tasks_, this_thread_id(), true);
+  if (fd >= 0) {
+    char buffer[64];
+    std::uint64_t ns;
+    const ::ssize_t size = ::pread(fd, buffer, sizeof(buffer), 0);
+    schedstat_ = size > 0 && parse_schedstat(buffer, buffer + size, ns);
+    ::close(fd);
+  }
+#endif
+}
+
+thread_cpu_sampler::~thread_cpu_sampler()
+{
+#if defined(ABZ_PROC_TASKS)
+  for (const task &t : open_) {
+    if (t.fd >= 0) ::close(t.fd);
+  }
+  if (tasks_ != nullptr) ::closedir(directory(tasks_));
+#endif
+}
+
+bool thread_cpu_sampler::snapshot(std::vector<sample> &samples)
+{
+  samples.clear();
+  if (!valid() || !list_tasks()) return false;
+  samples.reserve(open_.size());
+  for (task &t : open_) {
+    duration cpu_time;
+    // The threads that exited since the listing are skipped.
+    if (read_task(t, cpu_time)) samples.push_back(sample{t.id, cpu_time});
+  }
+  return true;
+}
+
+/// Lists the threads, opens the files of the new ones and closes the ones of the exited threads.
+bool thread_cpu_sampler::list_tasks()
+{
+#if defined(ABZ_PROC_TASKS)
+  ::DIR *const dir = directory(tasks_);
+  ::rewinddir(dir);
+  ids_.clear();
+  while (const ::dirent *entry = ::readdir(dir)) {
+    const char *name = entry->d_name;
+    const char *end = name;
+    while (*end != '\0') ++end;
+    std::uint64_t id;
+    if (parse_decimal(name, end, id) && name == end) ids_.push_back(static_cast<long>(id));
+  }
+  if (ids_.empty()) return false;
+  std::sort(ids_.begin(), ids_.end());
+
+  // Both lists are sorted: merge them in place, the open tasks first.
+  std::vector<task>::size_type kept = 0;
+  auto id = ids_.cbegin();
+  for (const task &t : open_) {
+    while (id != ids_.cend() && *id < t.id) ++id;
+    if (id != ids_.cend() && *id == t.id) {
+      open_[kept++] = t;
+    } else if (t.fd >= 0) {
+      ::close(t.fd);
+    }
+  }
+  open_.resize(kept);
+  const auto open_end = open_.size();
+  std::vector<task>::size_type i = 0;
+  for (const long new_id : ids_) {
+    while (i != open_end && open_[i].id < new_id) ++i;
+    if (i != open_end && open_[i].id == new_id) continue;
+    const int fd = open_task(tasks_, new_id, schedstat_);
+    if (fd >= 0) open_.push_back(task{new_id, fd});
+  }
+  std::inplace_merge(open_.begin(), open_.begin() + static_cast<std::ptrdiff_t>(open_end),
+                     open_.end(), [](const task &lhs, const task &rhs) { return lhs.id < rhs.id; });
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool thread_cpu_sampler::read_task(task &t, duration &cpu_time)
+{
+#if defined(ABZ_PROC_TASKS)
+  std::int64_t ns;
+  if (t.fd < 0 || !read_cpu_time(t.fd, schedstat_, ns)) {
+    // The file of an exited thread cannot be read any more, even when a new thread reuses its
+    // identifier between two listings: the file of the new thread is opened instead.
+    if (t.fd >= 0) ::close(t.fd);
+    t.fd = open_task(tasks_, t.id, schedstat_);
+    if (t.fd < 0 || !read_cpu_time(t.fd, schedstat_, ns)) return false;
+  }
+  cpu_time = duration{static_cast<duration::rep>(ns)};
+  return true;
+#else
+  static_cast<void>(t);
+  static_cast<void>(cpu_time);
+  return false;
+#endif
+}
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
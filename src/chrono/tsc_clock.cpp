@@ -0,0 +1,184 @@
+// Copyright (C) 2015, 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "abz/chrono/tsc_clock.hpp"
+
+/// @file chrono/tsc_clock.cpp
+/// @brief tsc_clock implementation
+///
+/// @reference Intel 64 and IA-32 Architectures Software Developer's Manual, Volume 3, 18.17
+/// (Time-Stamp Counter).
+/// @reference https://www.kernel.org/doc/html/latest/virt/kvm/x86/timekeeping.html
+
+#include "abz/compiler.hpp"
+
+#include <cstdint>
+#include <thread>
+
+#if (defined(ABZ_COMPILER_GCC) || defined(ABZ_COMPILER_CLANG)) && defined(__x86_64__)        \
+  && defined(__SIZEOF_INT128__)
+#define ABZ_CHRONO_TSC
+#include <cpuid.h>     // __get_cpuid
+#include <x86intrin.h> // __rdtsc
+#endif
+
+ABZ_NAMESPACE_BEGIN
+
+namespace chrono {
+
+namespace {
+
+/// Duration of the calibration.
+constexpr std::chrono::milliseconds calibration_time{5};
+
+/// Conversion of the counter to the epoch of steady_clock:
+/// \f$ns = origin + ((tsc - tsc_origin) \cdot scale) / 2^{32}\f$.
+struct calibration {
+  bool tsc = false;
+  std::uint64_t tsc_origin = 0;
+  std::int64_t origin = 0;
+  std::uint64_t scale = 0; // Nanoseconds per tick, in 32.32 fixed point.
+  double frequency = 0.;
+};
+
+std::int64_t steady_nanoseconds() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+#if defined(ABZ_CHRONO_TSC)
+
+__extension__ using uint128_t = unsigned __int128;
+
+/// Checks the invariant TSC flag (CPUID.80000007H:EDX[8]).
+bool has_invariant_tsc() noexcept
+{
+  unsigned eax, ebx, ecx, edx;
+  if (__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007u) return false;
+  if (__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx) == 0) return false;
+  return (edx & (1u << 8)) != 0;
+}
+
+/// A reading of both clocks, taken between two reads of the counter.
+struct clock_pair {
+  std::uint64_t tsc;
+  std::int64_t steady;
+};
+
+/// Reads both clocks several times and keeps the pair read in the shortest time, which is the
+/// least likely to have been interrupted.
+clock_pair read_clock_pair() noexcept
+{
+  clock_pair best{0, 0};
+  std::uint64_t best_width = ~std::uint64_t{0};
+  for (int i = 0; i < 16; ++i) {
+    const std::uint64_t before = __rdtsc();
+    const std::int64_t steady = steady_nanoseconds();
+    const std::uint64_t after = __rdtsc();
+    if (after - before < best_width) {
+      best_width = after - before;
+      best = clock_pair{before + (after - before) / 2, steady};
+    }
+  }
+  return best;
+}
+
+#endif
+
+calibration calibrate() noexcept
+{
+  calibration c;
+#if defined(ABZ_CHRONO_TSC)
+  if (has_invariant_tsc()) {
+    const clock_pair start = read_clock_pair();
+    std::this_thread::sleep_for(calibration_time);
+    const clock_pair end = read_clock_pair();
+    const double ticks = static_cast<double>(end.tsc - start.tsc);
+    const double nanoseconds = static_cast<double>(end.steady - start.steady);
+    // A counter that did not move forward (e.g. badly virtualized) is not usable.
+    if (end.tsc > start.tsc && nanoseconds > 0.) {
+      c.tsc = true;
+      c.tsc_origin = end.tsc;
+      c.origin = end.steady;
+      c.scale = static_cast<std::uint64_t>(nanoseconds / ticks * 4294967296. + .5);
+      c.frequency = ticks / nanoseconds * 1e9;
+    }
+  }
+#endif
+  return c;
+}
+
+/// Returns the calibration, measured on the first call rather than when the library is loaded, so
+/// that the processes that do not use the clock do not wait for it.
+const calibration &state() noexcept
+{
+  static const calibration c = calibrate();
+  return c;
+}
+
+std::int64_t now_nanoseconds(const calibration &c) noexcept
+{
+#if defined(ABZ_CHRONO_TSC)
+  if (c.tsc) {
+    const std::uint64_t ticks = __rdtsc() - c.tsc_origin;
+    // Counters read on other cores right before the origin may be slightly behind it.
+    if (static_cast<std::int64_t>(ticks) < 0) return c.origin;
+    return c.origin + static_cast<std::int64_t>((uint128_t{ticks} * c.scale) >> 32);
+  }
+#endif
+  return steady_nanoseconds();
+}
+
+/// Measures the average cost of now().
+tsc_clock::duration measure_overhead() noexcept
+{
+  constexpr int calls = 4096;
+  std::int64_t best = 0;
+  for (int round = 0; round < 8; ++round) {
+    const std::int64_t start = tsc_clock::now().time_since_epoch().count();
+    std::int64_t last = start;
+    for (int i = 0; i < calls; ++i) last = tsc_clock::now().time_since_epoch().count();
+    const std::int64_t elapsed = last - start;
+    if (round == 0 || elapsed < best) best = elapsed;
+  }
+  return tsc_clock::duration{(best + calls / 2) / calls};
+}
+
+} // namespace
+
+auto tsc_clock::now() noexcept -> time_point
+{
+  return time_point{duration{now_nanoseconds(state())}};
+}
+
+bool tsc_clock::uses_tsc() noexcept
+{
+  return state().tsc;
+}
+
+double tsc_clock::frequency() noexcept
+{
+  return state().frequency;
+}
+
+auto tsc_clock::overhead() noexcept -> duration
+{
+  static const duration overhead = measure_overhead();
+  return overhead;
+}
+
+} // namespace chrono
+
+ABZ_NAMESPACE_END
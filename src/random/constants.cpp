@@ -0,0 +1,41 @@
+// Copyright (C) 2016 Pierre-Luc Perrier <pluc-dev@the-pluc.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file random/constants.cpp
+/// @brief Definitions of the static constants of the engines that are not templates.
+///
+/// Before C++17, a static constexpr data member that is ODR-used (e.g. bound to the reference
+/// parameter of <tt>std::min</tt>) needs a definition at namespace scope, in a single translation
+/// unit for the classes that are not templates. The templates define theirs in their header.
+
+#include "abz/random/bulk.hpp"
+#include "abz/random/pcg.hpp"
+#include "abz/random/quasi_random.hpp"
+#include "abz/random/wyrand.hpp"
+#include "abz/random/xoshiro.hpp"
+
+ABZ_NAMESPACE_BEGIN
+
+namespace random {
+
+constexpr xoshiro256starstar::result_type xoshiro256starstar::default_seed;
+constexpr std::size_t xoshiro256starstar_x8::lanes;
+constexpr pcg64::result_type pcg64::default_seed;
+constexpr wyrand::result_type wyrand::default_seed;
+constexpr std::uint64_t wyrand::increment;
+constexpr std::uint64_t sobol_sequence::max_points;
+
+} // namespace random
+
+ABZ_NAMESPACE_END